@@ -0,0 +1,169 @@
+#include "s21_matrix_cache.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr std::size_t kEntryOverhead = 128;  // узел списка и индекса
+
+inline std::uint64_t rotl(std::uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+inline std::uint64_t mix(std::uint64_t acc, std::uint64_t word) {
+  return rotl(acc + word * kPrime2, 31) * kPrime1;
+}
+
+}  // namespace
+
+S21MatrixCache::S21MatrixCache(std::size_t max_bytes) : _max_bytes(max_bytes) {}
+
+// публичные методы класса
+
+double S21MatrixCache::determinant(S21Matrix &matrix) {
+  Key key = make_key(matrix, Op::kDeterminant);
+  S21Matrix result(1, 1);
+  if (!lookup(key, matrix, &result)) {
+    result._matrix[0][0] = matrix.determinant();
+    store(key, matrix, result);
+  }
+  return result._matrix[0][0];
+}
+
+S21Matrix S21MatrixCache::inverse_matrix(S21Matrix &matrix) {
+  Key key = make_key(matrix, Op::kInverse);
+  S21Matrix result(1, 1);
+  if (!lookup(key, matrix, &result)) {
+    result = matrix.inverse_matrix();
+    store(key, matrix, result);
+  }
+  return result;
+}
+
+S21Matrix S21MatrixCache::calc_complements(S21Matrix &matrix) {
+  Key key = make_key(matrix, Op::kComplements);
+  S21Matrix result(1, 1);
+  if (!lookup(key, matrix, &result)) {
+    result = matrix.calc_complements();
+    store(key, matrix, result);
+  }
+  return result;
+}
+
+S21MatrixCache::Stats S21MatrixCache::stats() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  Stats result = _stats;
+  result.entries = _lru.size();
+  result.bytes = _bytes;
+  return result;
+}
+
+void S21MatrixCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _index.clear();
+  _lru.clear();
+  _bytes = 0;
+}
+
+void S21MatrixCache::set_max_bytes(std::size_t max_bytes) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _max_bytes = max_bytes;
+  evict(_max_bytes);
+}
+
+/* 4 независимые полосы по 64 бита: компилятор раскладывает цикл по
+ * векторным регистрам, итог перемешивается как в xxHash64 */
+std::uint64_t S21MatrixCache::hash(const S21Matrix &matrix) {
+  std::uint64_t lanes[4] = {kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1};
+  for (int i = 0; i < matrix._rows; i++) {
+    const double *row = matrix._matrix[i];
+    int j = 0;
+    for (; j + 4 <= matrix._cols; j += 4) {
+      std::uint64_t words[4];
+      std::memcpy(words, row + j, sizeof(words));
+      for (int l = 0; l < 4; l++) lanes[l] = mix(lanes[l], words[l]);
+    }
+    for (; j < matrix._cols; j++) {
+      std::uint64_t word;
+      std::memcpy(&word, row + j, sizeof(word));
+      lanes[j % 4] = mix(lanes[j % 4], word);
+    }
+  }
+  std::uint64_t h = rotl(lanes[0], 1) + rotl(lanes[1], 7) +
+                    rotl(lanes[2], 12) + rotl(lanes[3], 18);
+  h ^= (static_cast<std::uint64_t>(matrix._rows) << 32) ^
+       static_cast<std::uint64_t>(matrix._cols);
+  h ^= h >> 33;
+  h *= kPrime2;
+  h ^= h >> 29;
+  h *= kPrime3;
+  h ^= h >> 32;
+  return h;
+}
+
+// приватные методы класса
+
+bool S21MatrixCache::lookup(const Key &key, const S21Matrix &matrix,
+                            S21Matrix *result) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  bool found = false;
+  auto it = _index.find(key);
+  if (it != _index.end() && same(it->second->source, matrix)) {
+    _lru.splice(_lru.begin(), _lru, it->second);  // в начало: использована
+    *result = it->second->result;
+    found = true;
+    _stats.hits++;
+  } else {
+    _stats.misses++;
+  }
+  return found;
+}
+
+void S21MatrixCache::store(const Key &key, const S21Matrix &matrix,
+                           const S21Matrix &result) {
+  std::size_t bytes =
+      matrix_bytes(matrix) + matrix_bytes(result) + kEntryOverhead;
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto it = _index.find(key);
+  if (it != _index.end()) {  // коллизия хэша: заменяем старую запись
+    _bytes -= it->second->bytes;
+    _lru.erase(it->second);
+    _index.erase(it);
+  }
+  if (bytes <= _max_bytes) {
+    evict(_max_bytes - bytes);
+    _lru.push_front(Entry{key, matrix, result, bytes});
+    _index[key] = _lru.begin();
+    _bytes += bytes;
+  }
+}
+
+void S21MatrixCache::evict(std::size_t max_bytes) {
+  while (_bytes > max_bytes && !_lru.empty()) {
+    _bytes -= _lru.back().bytes;
+    _index.erase(_lru.back().key);
+    _lru.pop_back();
+    _stats.evictions++;
+  }
+}
+
+bool S21MatrixCache::same(const S21Matrix &a, const S21Matrix &b) {
+  bool result = a._rows == b._rows && a._cols == b._cols;
+  for (int i = 0; i < a._rows && result; i++) {
+    result = std::memcmp(a._matrix[i], b._matrix[i],
+                         sizeof(double) * a._cols) == 0;
+  }
+  return result;
+}
+
+std::size_t S21MatrixCache::matrix_bytes(const S21Matrix &matrix) {
+  return sizeof(double *) * matrix._rows +
+         sizeof(double) * matrix._rows * matrix._cols;
+}
+
+S21MatrixCache::Key S21MatrixCache::make_key(const S21Matrix &matrix, Op op) {
+  return Key{hash(matrix), matrix._rows, matrix._cols, op};
+}
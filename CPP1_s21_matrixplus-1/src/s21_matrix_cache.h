@@ -0,0 +1,84 @@
+#ifndef SRC_S21_MATRIX_CACHE_H_
+#define SRC_S21_MATRIX_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "s21_matrix_oop.h"
+
+/* Кэш результатов determinant, inverse_matrix и calc_complements с вытеснением
+ * давно не использованных (LRU) записей при превышении лимита памяти. Ключ -
+ * хэш содержимого матрицы; копия исходной матрицы хранится в записи, поэтому
+ * при коллизии хэша возвращается только результат для побитово той же
+ * матрицы. Ошибки (неквадратная, вырожденная матрица) не кэшируются. */
+class S21MatrixCache {
+ public:
+  // статистика кэша
+  struct Stats {
+    std::uint64_t hits{0};
+    std::uint64_t misses{0};
+    std::uint64_t evictions{0};
+    std::size_t entries{0};
+    std::size_t bytes{0};  // занято матрицами записей
+  };
+
+  explicit S21MatrixCache(std::size_t max_bytes = 64 << 20);
+  S21MatrixCache(const S21MatrixCache&) = delete;
+  S21MatrixCache& operator=(const S21MatrixCache&) = delete;
+
+  double determinant(S21Matrix& matrix);
+  S21Matrix inverse_matrix(S21Matrix& matrix);
+  S21Matrix calc_complements(S21Matrix& matrix);
+
+  Stats stats();
+  void clear();
+  void set_max_bytes(std::size_t max_bytes);
+
+  static std::uint64_t hash(const S21Matrix& matrix);  // хэш содержимого
+
+ private:
+  enum class Op { kDeterminant, kInverse, kComplements };
+
+  struct Key {
+    std::uint64_t hash;
+    int rows;
+    int cols;
+    Op op;
+    bool operator==(const Key& other) const {
+      return hash == other.hash && rows == other.rows && cols == other.cols &&
+             op == other.op;
+    }
+  };
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+      return static_cast<std::size_t>(
+          key.hash ^ (static_cast<std::uint64_t>(key.op) << 61));
+    }
+  };
+  struct Entry {
+    Key key;
+    S21Matrix source;  // исходная матрица для проверки совпадения
+    S21Matrix result;  // для determinant - матрица 1x1
+    std::size_t bytes;
+  };
+  using List = std::list<Entry>;
+
+  std::size_t _max_bytes;
+  std::size_t _bytes{0};
+  Stats _stats;
+  List _lru;  // в начале - последние использованные
+  std::unordered_map<Key, List::iterator, KeyHash> _index;
+  std::mutex _mutex;
+
+  bool lookup(const Key& key, const S21Matrix& matrix, S21Matrix* result);
+  void store(const Key& key, const S21Matrix& matrix, const S21Matrix& result);
+  void evict(std::size_t max_bytes);
+  static bool same(const S21Matrix& a, const S21Matrix& b);
+  static std::size_t matrix_bytes(const S21Matrix& matrix);
+  static Key make_key(const S21Matrix& matrix, Op op);
+};
+
+#endif  // SRC_S21_MATRIX_CACHE_H_
@@ -0,0 +1,315 @@
+#include "s21_matrix_dist.h"
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+/* S21LocalTransport */
+
+struct S21LocalTransport::Hub {
+  explicit Hub(int size)
+      : size(size), queues(static_cast<std::size_t>(size) * size) {}
+
+  int size;
+  std::mutex mutex;
+  std::condition_variable ready;
+  std::vector<std::deque<std::vector<double>>> queues;  // [from * size + to]
+};
+
+std::vector<std::unique_ptr<S21Transport>> S21LocalTransport::create(
+    int size) {
+  if (size <= 0) throw std::invalid_argument(EXCP_GRID);
+  std::shared_ptr<Hub> hub = std::make_shared<Hub>(size);
+  std::vector<std::unique_ptr<S21Transport>> result;
+  for (int i = 0; i < size; i++) {
+    result.emplace_back(new S21LocalTransport(hub, i));
+  }
+  return result;
+}
+
+S21LocalTransport::S21LocalTransport(std::shared_ptr<Hub> hub, int rank)
+    : _hub(std::move(hub)), _rank(rank) {}
+
+int S21LocalTransport::size() const { return _hub->size; }
+
+void S21LocalTransport::send(int to, const double *data, std::size_t count) {
+  {
+    std::lock_guard<std::mutex> lock(_hub->mutex);
+    _hub->queues[_rank * _hub->size + to].emplace_back(data, data + count);
+  }
+  _hub->ready.notify_all();
+}
+
+std::vector<double> S21LocalTransport::recv(int from) {
+  std::unique_lock<std::mutex> lock(_hub->mutex);
+  auto &queue = _hub->queues[from * _hub->size + _rank];
+  _hub->ready.wait(lock, [&queue]() { return !queue.empty(); });
+  std::vector<double> result = std::move(queue.front());
+  queue.pop_front();
+  return result;
+}
+
+/* S21SocketTransport */
+
+S21SocketTransport::Mesh S21SocketTransport::make_mesh(int size) {
+  if (size <= 0) throw std::invalid_argument(EXCP_GRID);
+  Mesh mesh(size, std::vector<int>(size, -1));
+  for (int i = 0; i < size; i++) {
+    for (int j = i + 1; j < size; j++) {
+      int sv[2];
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) {
+        throw std::runtime_error(EXCP_TRANSPORT);
+      }
+      mesh[i][j] = sv[0];
+      mesh[j][i] = sv[1];
+    }
+  }
+  return mesh;
+}
+
+S21SocketTransport::S21SocketTransport(int rank, const Mesh &mesh)
+    : _rank(rank), _fds(mesh[rank]) {
+  for (int i = 0; i < static_cast<int>(mesh.size()); i++) {
+    if (i == rank) continue;
+    for (int fd : mesh[i]) {
+      if (fd >= 0) close(fd);
+    }
+  }
+}
+
+S21SocketTransport::~S21SocketTransport() {
+  for (int fd : _fds) {
+    if (fd >= 0) close(fd);
+  }
+}
+
+void S21SocketTransport::send(int to, const double *data, std::size_t count) {
+  std::uint64_t header = count;
+  write_all(_fds[to], &header, sizeof(header));
+  write_all(_fds[to], data, count * sizeof(double));
+}
+
+std::vector<double> S21SocketTransport::recv(int from) {
+  std::uint64_t header = 0;
+  read_all(_fds[from], &header, sizeof(header));
+  std::vector<double> result(header);
+  read_all(_fds[from], result.data(), result.size() * sizeof(double));
+  return result;
+}
+
+void S21SocketTransport::write_all(int fd, const void *data,
+                                   std::size_t bytes) {
+#ifdef MSG_NOSIGNAL
+  const int flags = MSG_NOSIGNAL;  // разрыв - исключение, а не SIGPIPE
+#else
+  const int flags = 0;
+#endif
+  const char *p = static_cast<const char *>(data);
+  while (bytes > 0) {
+    ssize_t n = ::send(fd, p, bytes, flags);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) throw std::runtime_error(EXCP_TRANSPORT);
+    p += n;
+    bytes -= static_cast<std::size_t>(n);
+  }
+}
+
+void S21SocketTransport::read_all(int fd, void *data, std::size_t bytes) {
+  char *p = static_cast<char *>(data);
+  while (bytes > 0) {
+    ssize_t n = ::read(fd, p, bytes);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) throw std::runtime_error(EXCP_TRANSPORT);
+    p += n;
+    bytes -= static_cast<std::size_t>(n);
+  }
+}
+
+/* S21DistMatrix */
+
+S21DistMatrix::S21DistMatrix(S21Transport &transport, int rows, int cols,
+                             const S21ProcessGrid &grid)
+    : _transport(transport), _grid(grid), _rows(rows), _cols(cols) {
+  if (rows <= 0 || cols <= 0 || grid.block <= 0) {
+    throw std::out_of_range(EXCP_INDX);
+  }
+  if (grid.rows <= 0 || grid.cols <= 0 ||
+      grid.rows * grid.cols != transport.size()) {
+    throw std::invalid_argument(EXCP_GRID);
+  }
+  _grid_row = transport.rank() / grid.cols;
+  _grid_col = transport.rank() % grid.cols;
+  _local_rows = local_count(rows, grid.block, _grid_row, grid.rows);
+  _local_cols = local_count(cols, grid.block, _grid_col, grid.cols);
+  _local.assign(static_cast<std::size_t>(_local_rows) * _local_cols, 0.0);
+}
+
+void S21DistMatrix::load(const S21Matrix &matrix) {
+  if (matrix._rows != _rows || matrix._cols != _cols) {
+    throw std::invalid_argument(EXCP_EQ);
+  }
+  _local = pack(matrix, _grid_row, _grid_col);
+}
+
+void S21DistMatrix::scatter(const S21Matrix *matrix, int root) {
+  if (_transport.rank() == root) {
+    if (matrix == NULL || matrix->_rows != _rows || matrix->_cols != _cols) {
+      throw std::invalid_argument(EXCP_EQ);
+    }
+    for (int r = 0; r < _transport.size(); r++) {
+      std::vector<double> part = pack(*matrix, r / _grid.cols, r % _grid.cols);
+      if (r == root) {
+        _local = std::move(part);
+      } else {
+        _transport.send(r, part.data(), part.size());
+      }
+    }
+  } else {
+    std::vector<double> part = _transport.recv(root);
+    if (part.size() != _local.size()) throw std::runtime_error(EXCP_TRANSPORT);
+    _local = std::move(part);
+  }
+}
+
+void S21DistMatrix::gather(S21Matrix *matrix, int root) {
+  if (_transport.rank() == root) {
+    if (matrix == NULL) throw std::invalid_argument(EXCP_EQ);
+    if (matrix->_rows != _rows || matrix->_cols != _cols) {
+      *matrix = S21Matrix(_rows, _cols);
+    }
+    for (int r = 0; r < _transport.size(); r++) {
+      if (r == root) {
+        unpack(_local, *matrix, _grid_row, _grid_col);
+      } else {
+        unpack(_transport.recv(r), *matrix, r / _grid.cols, r % _grid.cols);
+      }
+    }
+  } else {
+    _transport.send(root, _local.data(), _local.size());
+  }
+}
+
+void S21DistMatrix::multiply(const S21DistMatrix &a, const S21DistMatrix &b,
+                             S21DistMatrix &c) {
+  const S21ProcessGrid &grid = a._grid;
+  if (a._cols != b._rows || c._rows != a._rows || c._cols != b._cols) {
+    throw std::invalid_argument(EXCP_MUL);
+  }
+  if (grid.rows != b._grid.rows || grid.cols != b._grid.cols ||
+      grid.block != b._grid.block || grid.rows != c._grid.rows ||
+      grid.cols != c._grid.cols || grid.block != c._grid.block) {
+    throw std::invalid_argument(EXCP_GRID);
+  }
+  S21Transport &transport = c._transport;
+  std::fill(c._local.begin(), c._local.end(), 0.0);
+  int blocks = (a._cols + grid.block - 1) / grid.block;
+  std::vector<double> a_panel;
+  std::vector<double> b_panel;
+  for (int kb = 0; kb < blocks; kb++) {
+    int width = std::min(grid.block, a._cols - kb * grid.block);
+    // панель a: столбцы блока kb у всех своих строк, владелец - столбец
+    // решётки kb % grid.cols, рассылка вдоль строки решётки
+    int a_owner = kb % grid.cols;
+    if (a._grid_col == a_owner) {
+      int offset = (kb / grid.cols) * grid.block;
+      a_panel.resize(static_cast<std::size_t>(a._local_rows) * width);
+      for (int i = 0; i < a._local_rows; i++) {
+        const double *src = &a._local[i * a._local_cols + offset];
+        std::copy(src, src + width, &a_panel[i * width]);
+      }
+      for (int j = 0; j < grid.cols; j++) {
+        if (j == a_owner) continue;
+        transport.send(a._grid_row * grid.cols + j, a_panel.data(),
+                       a_panel.size());
+      }
+    } else {
+      a_panel = transport.recv(a._grid_row * grid.cols + a_owner);
+    }
+    // панель b: строки блока kb у всех своих столбцов, рассылка по столбцу
+    int b_owner = kb % grid.rows;
+    if (b._grid_row == b_owner) {
+      int offset = (kb / grid.rows) * grid.block;
+      // у ранга может не быть своих столбцов: тогда _local пуст и
+      // индексировать его нельзя, а панель пустая
+      const double *src = b._local.data() + offset * b._local_cols;
+      b_panel.assign(src, src + static_cast<std::size_t>(width) *
+                                    b._local_cols);
+      for (int i = 0; i < grid.rows; i++) {
+        if (i == b_owner) continue;
+        transport.send(i * grid.cols + b._grid_col, b_panel.data(),
+                       b_panel.size());
+      }
+    } else {
+      b_panel = transport.recv(b_owner * grid.cols + b._grid_col);
+    }
+    if (a_panel.size() != static_cast<std::size_t>(c._local_rows) * width ||
+        b_panel.size() != static_cast<std::size_t>(width) * c._local_cols) {
+      throw std::runtime_error(EXCP_TRANSPORT);
+    }
+    // c_local += a_panel * b_panel, порядок i-k-j
+    for (int i = 0; i < c._local_rows; i++) {
+      double *row = c._local.data() + i * c._local_cols;
+      for (int k = 0; k < width; k++) {
+        double factor = a_panel[i * width + k];
+        const double *b_row = b_panel.data() + k * c._local_cols;
+        for (int j = 0; j < c._local_cols; j++) row[j] += factor * b_row[j];
+      }
+    }
+  }
+}
+
+// приватные методы класса
+
+/* число строк (столбцов) из n, попадающих на координату coord из procs */
+int S21DistMatrix::local_count(int n, int block, int coord, int procs) {
+  int blocks = n / block;
+  int result = (blocks / procs) * block;
+  int extra = blocks % procs;
+  if (coord < extra) {
+    result += block;
+  } else if (coord == extra) {
+    result += n % block;
+  }
+  return result;
+}
+
+int S21DistMatrix::to_global(int local, int block, int coord, int procs) {
+  return ((local / block) * procs + coord) * block + local % block;
+}
+
+std::vector<double> S21DistMatrix::pack(const S21Matrix &matrix, int grid_row,
+                                        int grid_col) const {
+  int rows = local_count(_rows, _grid.block, grid_row, _grid.rows);
+  int cols = local_count(_cols, _grid.block, grid_col, _grid.cols);
+  std::vector<double> result(static_cast<std::size_t>(rows) * cols);
+  for (int i = 0; i < rows; i++) {
+    const double *src =
+        matrix._matrix[to_global(i, _grid.block, grid_row, _grid.rows)];
+    for (int j = 0; j < cols; j++) {
+      result[i * cols + j] =
+          src[to_global(j, _grid.block, grid_col, _grid.cols)];
+    }
+  }
+  return result;
+}
+
+void S21DistMatrix::unpack(const std::vector<double> &data, S21Matrix &matrix,
+                           int grid_row, int grid_col) const {
+  int rows = local_count(_rows, _grid.block, grid_row, _grid.rows);
+  int cols = local_count(_cols, _grid.block, grid_col, _grid.cols);
+  if (data.size() != static_cast<std::size_t>(rows) * cols) {
+    throw std::runtime_error(EXCP_TRANSPORT);
+  }
+  for (int i = 0; i < rows; i++) {
+    double *dst =
+        matrix._matrix[to_global(i, _grid.block, grid_row, _grid.rows)];
+    for (int j = 0; j < cols; j++) {
+      dst[to_global(j, _grid.block, grid_col, _grid.cols)] = data[i * cols + j];
+    }
+  }
+}
@@ -0,0 +1,122 @@
+#ifndef SRC_S21_MATRIX_DIST_H_
+#define SRC_S21_MATRIX_DIST_H_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// сообщения исключений
+
+/* runtime_error: сбой канала между процессами (разрыв, ошибка чтения) */
+#define EXCP_TRANSPORT "Transport error, connection to peer failed."
+/* invalid_argument: размер решётки процессов не совпадает с числом рангов */
+#define EXCP_GRID "Incorrect input, process grid does not match transport."
+
+/* Транспорт между рангами 0..size()-1. Сообщения между парой рангов
+ * доставляются по порядку; этого достаточно, так как все ранги выполняют
+ * одну и ту же последовательность обменов. Для кластера достаточно
+ * реализовать этот интерфейс поверх MPI или TCP. */
+class S21Transport {
+ public:
+  virtual ~S21Transport() = default;
+  virtual int rank() const = 0;
+  virtual int size() const = 0;
+  virtual void send(int to, const double* data, std::size_t count) = 0;
+  virtual std::vector<double> recv(int from) = 0;
+};
+
+/* Ранги - потоки одного процесса, общие очереди в памяти. */
+class S21LocalTransport : public S21Transport {
+ public:
+  static std::vector<std::unique_ptr<S21Transport>> create(int size);
+
+  int rank() const override { return _rank; }
+  int size() const override;
+  void send(int to, const double* data, std::size_t count) override;
+  std::vector<double> recv(int from) override;
+
+ private:
+  struct Hub;
+  S21LocalTransport(std::shared_ptr<Hub> hub, int rank);
+
+  std::shared_ptr<Hub> _hub;
+  int _rank;
+};
+
+/* Ранги - процессы одной машины, связанные парами Unix-сокетов. Сетка
+ * сокетов создаётся make_mesh до fork, после fork каждый процесс создаёт
+ * транспорт со своим рангом, остальные дескрипторы закрываются. */
+class S21SocketTransport : public S21Transport {
+ public:
+  using Mesh = std::vector<std::vector<int>>;  // [i][j] - конец i в канале i-j
+
+  static Mesh make_mesh(int size);
+  S21SocketTransport(int rank, const Mesh& mesh);
+  ~S21SocketTransport() override;
+  S21SocketTransport(const S21SocketTransport&) = delete;
+  S21SocketTransport& operator=(const S21SocketTransport&) = delete;
+
+  int rank() const override { return _rank; }
+  int size() const override { return static_cast<int>(_fds.size()); }
+  void send(int to, const double* data, std::size_t count) override;
+  std::vector<double> recv(int from) override;
+
+ private:
+  int _rank;
+  std::vector<int> _fds;  // -1 для своего ранга
+
+  static void write_all(int fd, const void* data, std::size_t bytes);
+  static void read_all(int fd, void* data, std::size_t bytes);
+};
+
+// решётка процессов rows x cols и размер блока распределения
+struct S21ProcessGrid {
+  int rows{1};
+  int cols{1};
+  int block{64};
+};
+
+/* Матрица, распределённая по решётке процессов блочно-циклически (как в
+ * ScaLAPACK): блок (bi, bj) хранит ранг (bi % grid.rows) * grid.cols +
+ * bj % grid.cols. Все методы коллективные - их вызывают все ранги. */
+class S21DistMatrix {
+ public:
+  S21DistMatrix(S21Transport& transport, int rows, int cols,
+                const S21ProcessGrid& grid);
+
+  int get_rows() const { return _rows; }
+  int get_cols() const { return _cols; }
+  int local_rows() const { return _local_rows; }
+  int local_cols() const { return _local_cols; }
+
+  void load(const S21Matrix& matrix);  // свои блоки из копии всей матрицы
+  void scatter(const S21Matrix* matrix, int root = 0);  // matrix - на root
+  void gather(S21Matrix* matrix, int root = 0);  // вся матрица - на root
+
+  // c = a * b алгоритмом SUMMA: панели a рассылаются по строкам решётки,
+  // панели b - по столбцам, каждый ранг умножает только свои блоки
+  static void multiply(const S21DistMatrix& a, const S21DistMatrix& b,
+                       S21DistMatrix& c);
+
+ private:
+  S21Transport& _transport;
+  S21ProcessGrid _grid;
+  int _rows;
+  int _cols;
+  int _grid_row;  // координаты ранга в решётке
+  int _grid_col;
+  int _local_rows;
+  int _local_cols;
+  std::vector<double> _local;  // свои блоки, построчно
+
+  static int local_count(int n, int block, int coord, int procs);
+  static int to_global(int local, int block, int coord, int procs);
+  std::vector<double> pack(const S21Matrix& matrix, int grid_row,
+                           int grid_col) const;
+  void unpack(const std::vector<double>& data, S21Matrix& matrix, int grid_row,
+              int grid_col) const;
+};
+
+#endif  // SRC_S21_MATRIX_DIST_H_
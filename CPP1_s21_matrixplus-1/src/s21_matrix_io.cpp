@@ -0,0 +1,194 @@
+#include "s21_matrix_io.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/* пробельный символ, не являющийся разделителем столбцов (для '\t') */
+inline bool is_blank(char c, char delimiter = ' ') {
+  return (c == ' ' || c == '\t' || c == '\r') &&
+         (delimiter == ' ' || c != delimiter);
+}
+
+inline const char* skip_blank(const char* p, const char* end,
+                              char delimiter = ' ') {
+  while (p != end && is_blank(*p, delimiter)) p++;
+  return p;
+}
+
+/* разбивает текст на непустые строки без копирования */
+std::vector<std::string_view> split_lines(std::string_view text) {
+  std::vector<std::string_view> lines;
+  const char* p = text.data();
+  const char* end = p + text.size();
+  while (p != end) {
+    const char* eol =
+        static_cast<const char*>(std::memchr(p, '\n', end - p));
+    if (eol == NULL) eol = end;
+    if (skip_blank(p, eol) != eol) lines.emplace_back(p, eol - p);
+    p = (eol == end) ? end : eol + 1;
+  }
+  return lines;
+}
+
+}  // namespace
+
+// публичные методы класса
+
+/* ввод */
+
+S21Matrix S21MatrixIO::parse(std::string_view text,
+                             const S21MatrixFormat& format) {
+  std::vector<std::string_view> lines = split_lines(text);
+  if (lines.empty()) throw std::invalid_argument(EXCP_PARSE);
+  int rows = static_cast<int>(lines.size());
+  int cols = count_cols(lines[0], format.delimiter);
+  if (cols <= 0) throw std::invalid_argument(EXCP_PARSE);
+  S21Matrix result(rows, cols);
+
+  int threads = format.threads;
+  if (threads <= 0) threads = std::thread::hardware_concurrency();
+  threads = std::max(1, std::min(threads, rows / kMinRowsPerThread));
+
+  // каждый поток разбирает свой непрерывный диапазон строк
+  auto work = [&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      parse_row(lines[i], format.delimiter, result._matrix[i], cols);
+    }
+  };
+  if (threads == 1) {
+    work(0, rows);
+  } else {
+    std::vector<std::thread> pool;
+    std::vector<std::exception_ptr> errors(threads);
+    int step = (rows + threads - 1) / threads;
+    for (int t = 0; t < threads; t++) {
+      int from = t * step;
+      int to = std::min(rows, from + step);
+      pool.emplace_back([&, t, from, to]() {
+        try {
+          work(from, to);
+        } catch (...) {
+          errors[t] = std::current_exception();
+        }
+      });
+    }
+    for (auto& th : pool) th.join();
+    for (auto& e : errors) {
+      if (e) std::rethrow_exception(e);
+    }
+  }
+  return result;
+}
+
+S21Matrix S21MatrixIO::load(const std::string& path,
+                            const S21MatrixFormat& format) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.is_open()) throw std::invalid_argument(EXCP_FILE);
+  std::string text;
+  in.seekg(0, std::ios::end);
+  std::streamoff size = in.tellg();
+  in.seekg(0, std::ios::beg);
+  if (size > 0) text.reserve(static_cast<std::size_t>(size));
+  // читаем блоками, не полагаясь на точность tellg
+  std::vector<char> chunk(kChunk);
+  while (in.read(chunk.data(), chunk.size()) || in.gcount() > 0) {
+    text.append(chunk.data(), static_cast<std::size_t>(in.gcount()));
+  }
+  return parse(text, format);
+}
+
+/* вывод */
+
+std::string S21MatrixIO::to_string(const S21Matrix& matrix,
+                                   const S21MatrixFormat& format) {
+  std::string buf;
+  // ~ 24 символа на число в кратчайшей записи double
+  buf.reserve(static_cast<std::size_t>(matrix._rows) * matrix._cols * 24);
+  for (int i = 0; i < matrix._rows; i++) {
+    append_row(buf, matrix._matrix[i], matrix._cols, format.delimiter);
+  }
+  return buf;
+}
+
+void S21MatrixIO::write(std::ostream& out, const S21Matrix& matrix,
+                        const S21MatrixFormat& format) {
+  std::string buf;
+  buf.reserve(kChunk + 64);
+  for (int i = 0; i < matrix._rows; i++) {
+    append_row(buf, matrix._matrix[i], matrix._cols, format.delimiter);
+    if (buf.size() >= kChunk) {
+      out.write(buf.data(), buf.size());
+      buf.clear();
+    }
+  }
+  out.write(buf.data(), buf.size());
+}
+
+void S21MatrixIO::save(const std::string& path, const S21Matrix& matrix,
+                       const S21MatrixFormat& format) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out.is_open()) throw std::invalid_argument(EXCP_FILE);
+  write(out, matrix, format);
+  if (!out.flush()) throw std::invalid_argument(EXCP_FILE);
+}
+
+// приватные методы класса
+
+int S21MatrixIO::count_cols(std::string_view line, char delimiter) {
+  const char* p = line.data();
+  const char* end = p + line.size();
+  int result = 0;
+  if (delimiter == ' ') {
+    while ((p = skip_blank(p, end)) != end) {
+      result++;
+      while (p != end && !is_blank(*p)) p++;
+    }
+  } else {
+    result = 1;
+    for (; p != end; p++) {
+      if (*p == delimiter) result++;
+    }
+  }
+  return result;
+}
+
+void S21MatrixIO::parse_row(std::string_view line, char delimiter, double* row,
+                            int cols) {
+  const char* p = line.data();
+  const char* end = p + line.size();
+  for (int j = 0; j < cols; j++) {
+    p = skip_blank(p, end, delimiter);
+    if (j != 0 && delimiter != ' ') {
+      if (p == end || *p != delimiter) throw std::invalid_argument(EXCP_PARSE);
+      p = skip_blank(p + 1, end, delimiter);
+    }
+    std::from_chars_result res = std::from_chars(p, end, row[j]);
+    if (res.ec != std::errc()) throw std::invalid_argument(EXCP_PARSE);
+    p = res.ptr;
+    if (p != end && !is_blank(*p) && *p != delimiter) {
+      throw std::invalid_argument(EXCP_PARSE);
+    }
+  }
+  if (skip_blank(p, end, delimiter) != end) {
+    throw std::invalid_argument(EXCP_PARSE);
+  }
+}
+
+void S21MatrixIO::append_row(std::string& buf, const double* row, int cols,
+                             char delimiter) {
+  char num[32];
+  for (int j = 0; j < cols; j++) {
+    if (j != 0) buf.push_back(delimiter);
+    std::to_chars_result res = std::to_chars(num, num + sizeof(num), row[j]);
+    buf.append(num, res.ptr);
+  }
+  buf.push_back('\n');
+}
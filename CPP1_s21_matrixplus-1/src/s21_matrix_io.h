@@ -0,0 +1,54 @@
+#ifndef SRC_S21_MATRIX_IO_H_
+#define SRC_S21_MATRIX_IO_H_
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "s21_matrix_oop.h"
+
+// сообщения исключений
+
+/* invalid_argument: текст не является корректной матрицей (пустой, разное
+ * число столбцов в строках, нечисловые поля) */
+#define EXCP_PARSE "Incorrect input, malformed matrix text."
+/* invalid_argument: файл не удалось открыть для чтения или записи */
+#define EXCP_FILE "Incorrect input, cannot open matrix file."
+
+// параметры текстового формата матрицы
+struct S21MatrixFormat {
+  char delimiter{','};  // разделитель столбцов, ' ' - любые пробелы и табуляции
+  int threads{1};       // число потоков разбора, 0 - по числу ядер
+};
+
+/* Быстрый ввод-вывод матриц в текстовом виде (CSV или через пробелы): одна
+ * строка файла - одна строка матрицы. Числа разбираются std::from_chars и
+ * печатаются std::to_chars в кратчайшей форме, поэтому запись и последующее
+ * чтение дают побитово ту же матрицу. */
+class S21MatrixIO {
+ public:
+  static S21Matrix parse(std::string_view text,
+                         const S21MatrixFormat& format = S21MatrixFormat());
+  static S21Matrix load(const std::string& path,
+                        const S21MatrixFormat& format = S21MatrixFormat());
+
+  static std::string to_string(
+      const S21Matrix& matrix,
+      const S21MatrixFormat& format = S21MatrixFormat());
+  static void write(std::ostream& out, const S21Matrix& matrix,
+                    const S21MatrixFormat& format = S21MatrixFormat());
+  static void save(const std::string& path, const S21Matrix& matrix,
+                   const S21MatrixFormat& format = S21MatrixFormat());
+
+ private:
+  static constexpr std::size_t kChunk = 1 << 16;  // размер блока ввода-вывода
+  static constexpr int kMinRowsPerThread = 256;  // меньше - не стоит потока
+
+  static int count_cols(std::string_view line, char delimiter);
+  static void parse_row(std::string_view line, char delimiter, double* row,
+                        int cols);
+  static void append_row(std::string& buf, const double* row, int cols,
+                         char delimiter);
+};
+
+#endif  // SRC_S21_MATRIX_IO_H_
@@ -1,5 +1,7 @@
 #include "s21_matrix_oop.h"
 
+#include "s21_matrix_stats.h"
+
 // публичные методы класса
 
 /* конструкторы и деструкторы */
@@ -90,6 +92,7 @@ void S21Matrix::sum_matrix(const S21Matrix &other) {
   if (this->is_correct_eq(other) != true) {
     throw std::invalid_argument(EXCP_EQ);
   }
+  S21_STATS_OP(kSum, _rows * _cols, 3 * sizeof(double) * _rows * _cols);
   for (int i = 0; i < this->_rows; i++) {
     for (int j = 0; j < this->_cols; j++) {
       this->_matrix[i][j] += other._matrix[i][j];
@@ -101,6 +104,7 @@ void S21Matrix::sub_matrix(const S21Matrix &other) {
   if (this->is_correct_eq(other) != true) {
     throw std::invalid_argument(EXCP_EQ);
   }
+  S21_STATS_OP(kSub, _rows * _cols, 3 * sizeof(double) * _rows * _cols);
   for (int i = 0; i < this->_rows; i++) {
     for (int j = 0; j < this->_cols; j++) {
       this->_matrix[i][j] -= other._matrix[i][j];
@@ -109,6 +113,7 @@ void S21Matrix::sub_matrix(const S21Matrix &other) {
 }
 
 void S21Matrix::mul_number(const double num) {
+  S21_STATS_OP(kMulNumber, _rows * _cols, 2 * sizeof(double) * _rows * _cols);
   for (int i = 0; i < this->_rows; i++) {
     for (int j = 0; j < this->_cols; j++) {
       this->_matrix[i][j] *= num;
@@ -121,23 +126,12 @@ void S21Matrix::mul_matrix(const S21Matrix &other) {
     throw std::invalid_argument(EXCP_MUL);
   }
   S21Matrix result(this->_rows, other._cols);
-  for (int i = 0; i < result._rows; i++) {
-    for (int j = 0; j < result._cols; j++) {
-      result._matrix[i][j] = 0;
-      for (int k = 0; k < this->_cols; k++) {
-        result._matrix[i][j] += this->_matrix[i][k] * other._matrix[k][j];
-      }
-    }
-  }
-  // this->std::move(result);   TODO move?
-  remove_matrix();
-  this->_matrix = result._matrix;
-  this->_rows = result._rows;
-  this->_cols = result._cols;
-  result._matrix = NULL;
+  multiply_into(*this, other, result);
+  swap_buffers(result);  // старая память освободится в деструкторе result
 }
 
 S21Matrix S21Matrix::transpose() {
+  S21_STATS_OP(kTranspose, 0, 2 * sizeof(double) * _rows * _cols);
   S21Matrix result(this->_cols, this->_rows);
   for (int i = 0; i < result._rows; i++) {
     for (int j = 0; j < result._cols; j++) {
@@ -151,6 +145,8 @@ S21Matrix S21Matrix::calc_complements() {
   if (this->is_correct_square() != true) {
     throw std::invalid_argument(EXCP_SQ);
   }
+  S21_STATS_OP(kCalcComplements, _rows * _cols,
+               2 * sizeof(double) * _rows * _cols);
   S21Matrix result(this->_rows, this->_rows);
 
   if (this->_cols == 1) {
@@ -172,6 +168,9 @@ double S21Matrix::determinant() {
   if (this->is_correct_square() != true) {
     throw std::invalid_argument(EXCP_SQ);
   }
+  // разложение по первой строке: умножение и сложение на каждый минор
+  S21_STATS_OP(kDeterminant, (_cols > 1) ? 2 * _cols : 0,
+               sizeof(double) * _cols);
   double result = 0.0;
   if (this->_cols == 1) {
     result = this->_matrix[0][0];
@@ -189,6 +188,7 @@ S21Matrix S21Matrix::inverse_matrix() {
   if (this->is_correct_square() != true) {
     throw std::invalid_argument(EXCP_SQ);
   }
+  S21_STATS_OP(kInverse, 1, 0);
   double det = this->determinant();
   if (det == 0) {
     throw std::invalid_argument(EXCP_DET);
@@ -199,6 +199,92 @@ S21Matrix S21Matrix::inverse_matrix() {
   return result;
 }
 
+void S21Matrix::hadamard_mul(const S21Matrix &other) {
+  if (this->is_correct_eq(other) != true) {
+    throw std::invalid_argument(EXCP_EQ);
+  }
+  S21_STATS_OP(kHadamard, _rows * _cols, 3 * sizeof(double) * _rows * _cols);
+  for (int i = 0; i < this->_rows; i++) {
+    double *row = this->_matrix[i];
+    const double *other_row = other._matrix[i];
+    for (int j = 0; j < this->_cols; j++) row[j] *= other_row[j];
+  }
+}
+
+void S21Matrix::hadamard_div(const S21Matrix &other) {
+  if (this->is_correct_eq(other) != true) {
+    throw std::invalid_argument(EXCP_EQ);
+  }
+  S21_STATS_OP(kHadamard, _rows * _cols, 3 * sizeof(double) * _rows * _cols);
+  for (int i = 0; i < this->_rows; i++) {
+    double *row = this->_matrix[i];
+    const double *other_row = other._matrix[i];
+    for (int j = 0; j < this->_cols; j++) row[j] /= other_row[j];
+  }
+}
+
+S21Matrix S21Matrix::kronecker(const S21Matrix &other) {
+  S21Matrix result(this->_rows * other._rows, this->_cols * other._cols);
+  kronecker(other, result);
+  return result;
+}
+
+void S21Matrix::kronecker(const S21Matrix &other, S21Matrix &result) {
+  if (result._rows != this->_rows * other._rows ||
+      result._cols != this->_cols * other._cols || &result == this ||
+      &result == &other) {
+    throw std::invalid_argument(EXCP_EQ);
+  }
+  S21_STATS_OP(kKronecker, result._rows * result._cols,
+               sizeof(double) * (_rows * _cols + other._rows * other._cols +
+                                 result._rows * result._cols));
+  for (int i = 0; i < this->_rows; i++) {
+    for (int k = 0; k < other._rows; k++) {
+      double *out = result._matrix[i * other._rows + k];
+      const double *b = other._matrix[k];
+      for (int j = 0; j < this->_cols; j++) {
+        double a = this->_matrix[i][j];
+        for (int l = 0; l < other._cols; l++) *out++ = a * b[l];
+      }
+    }
+  }
+}
+
+S21Matrix S21Matrix::power(int k) {
+  if (this->is_correct_square() != true) {
+    throw std::invalid_argument(EXCP_SQ);
+  }
+  if (k < 0) {
+    throw std::invalid_argument(EXCP_POW);
+  }
+  S21_STATS_OP(kPower, 0, 0);
+  if (k == 0) {
+    S21Matrix identity(this->_rows);
+    for (int i = 0; i < this->_rows; i++) identity._matrix[i][i] = 1;
+    return identity;
+  }
+  S21Matrix base(*this);
+  S21Matrix scratch(this->_rows);
+  // младшие нулевые биты степени: только возведение в квадрат, два буфера
+  while (k % 2 == 0) {
+    multiply_into(base, base, scratch);
+    base.swap_buffers(scratch);
+    k /= 2;
+  }
+  if (k == 1) return base;
+  // младший единичный бит забирает текущее base, дальше нужен третий буфер
+  S21Matrix result(base);
+  for (k /= 2; k > 0; k /= 2) {
+    multiply_into(base, base, scratch);
+    base.swap_buffers(scratch);
+    if (k % 2 == 1) {
+      multiply_into(result, base, scratch);
+      result.swap_buffers(scratch);
+    }
+  }
+  return result;
+}
+
 /* перегрузка операторов.*/
 
 S21Matrix S21Matrix::operator+(const S21Matrix &other) {
@@ -280,13 +366,13 @@ double &S21Matrix::operator()(int row, int col) {
 }
 
 std::ostream &operator<<(std::ostream &out, const S21Matrix &matrix) {
-  out << "[" << matrix._rows << "," << matrix._cols << "]" << std::endl;
+  out << "[" << matrix._rows << "," << matrix._cols << "]" << '\n';
   for (int i = 0; i < matrix._rows; i++) {
     for (int j = 0; j < matrix._cols; j++) {
       if (j != 0) out << "\t";
       out << matrix._matrix[i][j];
     }
-    out << std::endl;
+    out << '\n';
   }
   return out;
 }
@@ -348,6 +434,23 @@ S21Matrix S21Matrix::get_minor(const S21Matrix &other, int n, int m) {
   return result;
 }
 
+void S21Matrix::multiply_into(const S21Matrix &a, const S21Matrix &b,
+                              S21Matrix &out) {
+  S21_STATS_OP(kMulMatrix, 2.0 * a._rows * a._cols * b._cols,
+               sizeof(double) * (a._rows * a._cols + b._rows * b._cols +
+                                 a._rows * b._cols));
+  // порядок i-k-j: строки b и out читаются последовательно
+  for (int i = 0; i < a._rows; i++) {
+    double *row = out._matrix[i];
+    for (int j = 0; j < b._cols; j++) row[j] = 0;
+    for (int k = 0; k < a._cols; k++) {
+      double factor = a._matrix[i][k];
+      const double *b_row = b._matrix[k];
+      for (int j = 0; j < b._cols; j++) row[j] += factor * b_row[j];
+    }
+  }
+}
+
 /* функции работы с памятью */
 
 void S21Matrix::create_matrix(int rows, int cols) {
@@ -356,14 +459,22 @@ void S21Matrix::create_matrix(int rows, int cols) {
   this->_matrix = new double *[this->_rows]();
   for (int i = 0; i < this->_rows; i++)
     this->_matrix[i] = new double[this->_cols]();
+  S21_STATS_ALLOC(sizeof(double *) * rows + sizeof(double) * rows * cols);
 }
 
 void S21Matrix::remove_matrix() {
+  S21_STATS_FREE(sizeof(double *) * _rows + sizeof(double) * _rows * _cols);
   for (int i = 0; i < _rows; i++) delete[] this->_matrix[i];
   delete[] this->_matrix;
   this->_matrix = NULL;
 }
 
+void S21Matrix::swap_buffers(S21Matrix &other) {
+  std::swap(this->_rows, other._rows);
+  std::swap(this->_cols, other._cols);
+  std::swap(this->_matrix, other._matrix);
+}
+
 void S21Matrix::resize_matrix(int rows, int cols) {
   if (rows != this->_rows || cols != this->_cols) {
     if (rows <= 0 || cols <= 0) {
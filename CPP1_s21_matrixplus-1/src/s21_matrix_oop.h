@@ -19,6 +19,7 @@
 #define EXCP_MUL "Invalid input, the number of columns is not equal of rows"
 #define EXCP_SQ "Incorrect input, matrix is not square."
 #define EXCP_DET "Incorrect input, matrix determinant is zero."
+#define EXCP_POW "Incorrect input, power is negative."
 
 class S21Matrix {
  private:                  // атрибуты класса
@@ -63,6 +64,17 @@ class S21Matrix {
                                  // текущей матрицы и возвращает ее
   double determinant();  // Вычисляет и возвращает определитель текущей матрицы
   S21Matrix inverse_matrix();  // Вычисляет и возвращает обратную матрицу
+  void hadamard_mul(
+      const S21Matrix& other);  // Поэлементно умножает текущую на вторую
+  void hadamard_div(
+      const S21Matrix& other);  // Поэлементно делит текущую на вторую
+  S21Matrix kronecker(
+      const S21Matrix& other);  // Кронекерово произведение текущей на вторую
+  void kronecker(const S21Matrix& other,
+                 S21Matrix& result);  // то же, в готовую матрицу размера
+                                      // rows*other.rows x cols*other.cols
+  S21Matrix power(int k);  // Возводит в степень k >= 0 повторным возведением в
+                           // квадрат, используя не более трёх буферов
 
   /* перегрузка операторов.*/
   S21Matrix operator+(const S21Matrix& other);  // Сложение двух матриц
@@ -93,6 +105,9 @@ class S21Matrix {
   friend std::ostream& operator<<(
       std::ostream& out,
       const S21Matrix& matrix);  // функция вывода матрицы
+  friend class S21MatrixIO;      // быстрый ввод-вывод (s21_matrix_io.h)
+  friend class S21MatrixCache;   // кэш результатов (s21_matrix_cache.h)
+  friend class S21DistMatrix;    // распределённая матрица (s21_matrix_dist.h)
 
  private:  // приватные методы класса
   /* проверка на корректность */
@@ -106,9 +121,12 @@ class S21Matrix {
   void create_matrix(int rows, int cols);  // выделение памяти
   void remove_matrix();                    // очистка памяти
   void resize_matrix(int rows, int cols);  // изменение размера
+  void swap_buffers(S21Matrix& other);     // обмен памятью без копирования
 
   /* операций над матрицами */
   S21Matrix get_minor(const S21Matrix& other, int n, int m);  // поиск минора
+  static void multiply_into(const S21Matrix& a, const S21Matrix& b,
+                            S21Matrix& out);  // out = a * b, out не a и не b
 };
 
 #endif  // SRC_S21_MATRIX_OOP_H_
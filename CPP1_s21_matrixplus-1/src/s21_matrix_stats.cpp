@@ -0,0 +1,152 @@
+#include "s21_matrix_stats.h"
+
+#include <atomic>
+
+namespace {
+
+constexpr int kOps = static_cast<int>(S21MatrixOp::kCount);
+
+struct AtomicOpStats {
+  std::atomic<std::uint64_t> calls{0};
+  std::atomic<std::uint64_t> flops{0};
+  std::atomic<std::uint64_t> bytes{0};
+  std::atomic<std::uint64_t> nanoseconds{0};
+};
+
+std::atomic<std::uint64_t> g_allocations{0};
+std::atomic<std::uint64_t> g_frees{0};
+std::atomic<std::uint64_t> g_bytes_allocated{0};
+std::atomic<std::uint64_t> g_bytes_freed{0};
+AtomicOpStats g_ops[kOps];
+
+thread_local int t_depth[kOps];  // глубина вложенности каждой операции
+
+inline void add(std::atomic<std::uint64_t>& counter, std::uint64_t value) {
+  if (value != 0) counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+inline std::uint64_t get(const std::atomic<std::uint64_t>& counter) {
+  return counter.load(std::memory_order_relaxed);
+}
+
+}  // namespace
+
+S21MatrixStats S21MatrixProfiler::snapshot() {
+  S21MatrixStats result;
+  result.allocations = get(g_allocations);
+  result.frees = get(g_frees);
+  result.bytes_allocated = get(g_bytes_allocated);
+  result.bytes_freed = get(g_bytes_freed);
+  for (int i = 0; i < kOps; i++) {
+    result.ops[i].calls = get(g_ops[i].calls);
+    result.ops[i].flops = get(g_ops[i].flops);
+    result.ops[i].bytes = get(g_ops[i].bytes);
+    result.ops[i].nanoseconds = get(g_ops[i].nanoseconds);
+  }
+  return result;
+}
+
+void S21MatrixProfiler::reset() {
+  g_allocations.store(0, std::memory_order_relaxed);
+  g_frees.store(0, std::memory_order_relaxed);
+  g_bytes_allocated.store(0, std::memory_order_relaxed);
+  g_bytes_freed.store(0, std::memory_order_relaxed);
+  for (int i = 0; i < kOps; i++) {
+    g_ops[i].calls.store(0, std::memory_order_relaxed);
+    g_ops[i].flops.store(0, std::memory_order_relaxed);
+    g_ops[i].bytes.store(0, std::memory_order_relaxed);
+    g_ops[i].nanoseconds.store(0, std::memory_order_relaxed);
+  }
+}
+
+std::string S21MatrixProfiler::to_json(const S21MatrixStats& stats) {
+  std::string out = "{\"allocations\":" + std::to_string(stats.allocations) +
+                    ",\"frees\":" + std::to_string(stats.frees) +
+                    ",\"bytes_allocated\":" +
+                    std::to_string(stats.bytes_allocated) +
+                    ",\"bytes_freed\":" + std::to_string(stats.bytes_freed) +
+                    ",\"ops\":{";
+  for (int i = 0; i < kOps; i++) {
+    const S21MatrixOpStats& op = stats.ops[i];
+    if (i != 0) out += ",";
+    out += "\"";
+    out += op_name(static_cast<S21MatrixOp>(i));
+    out += "\":{\"calls\":" + std::to_string(op.calls) +
+           ",\"flops\":" + std::to_string(op.flops) +
+           ",\"bytes\":" + std::to_string(op.bytes) +
+           ",\"ns\":" + std::to_string(op.nanoseconds) + "}";
+  }
+  out += "}}";
+  return out;
+}
+
+const char* S21MatrixProfiler::op_name(S21MatrixOp op) {
+  switch (op) {
+    case S21MatrixOp::kSum:
+      return "sum_matrix";
+    case S21MatrixOp::kSub:
+      return "sub_matrix";
+    case S21MatrixOp::kMulNumber:
+      return "mul_number";
+    case S21MatrixOp::kMulMatrix:
+      return "mul_matrix";
+    case S21MatrixOp::kTranspose:
+      return "transpose";
+    case S21MatrixOp::kCalcComplements:
+      return "calc_complements";
+    case S21MatrixOp::kDeterminant:
+      return "determinant";
+    case S21MatrixOp::kInverse:
+      return "inverse_matrix";
+    case S21MatrixOp::kHadamard:
+      return "hadamard";
+    case S21MatrixOp::kKronecker:
+      return "kronecker";
+    case S21MatrixOp::kPower:
+      return "power";
+    default:
+      return "unknown";
+  }
+}
+
+void S21MatrixProfiler::count_alloc(std::size_t bytes) {
+  add(g_allocations, 1);
+  add(g_bytes_allocated, bytes);
+}
+
+void S21MatrixProfiler::count_free(std::size_t bytes) {
+  add(g_frees, 1);
+  add(g_bytes_freed, bytes);
+}
+
+void S21MatrixProfiler::count_op(S21MatrixOp op, std::uint64_t calls,
+                                 std::uint64_t flops, std::uint64_t bytes,
+                                 std::uint64_t nanoseconds) {
+  AtomicOpStats& stats = g_ops[static_cast<int>(op)];
+  add(stats.calls, calls);
+  add(stats.flops, flops);
+  add(stats.bytes, bytes);
+  add(stats.nanoseconds, nanoseconds);
+}
+
+/* Scope */
+
+S21MatrixProfiler::Scope::Scope(S21MatrixOp op, std::uint64_t flops,
+                                std::uint64_t bytes)
+    : _op(op),
+      _flops(flops),
+      _bytes(bytes),
+      _outer(t_depth[static_cast<int>(op)]++ == 0) {
+  if (_outer) _start = std::chrono::steady_clock::now();
+}
+
+S21MatrixProfiler::Scope::~Scope() {
+  t_depth[static_cast<int>(_op)]--;
+  std::uint64_t ns = 0;
+  if (_outer) {
+    ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - _start)
+             .count();
+  }
+  count_op(_op, _outer ? 1 : 0, _flops, _bytes, ns);
+}
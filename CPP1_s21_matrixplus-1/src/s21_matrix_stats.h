@@ -0,0 +1,93 @@
+#ifndef SRC_S21_MATRIX_STATS_H_
+#define SRC_S21_MATRIX_STATS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/* Счётчики операций S21Matrix. Сами счётчики и снимки доступны всегда, а
+ * вызовы из методов матрицы компилируются только с -DS21_MATRIX_STATS (make
+ * stats), иначе макросы ниже раскрываются в пустые выражения. */
+
+// отслеживаемые операции
+enum class S21MatrixOp {
+  kSum,
+  kSub,
+  kMulNumber,
+  kMulMatrix,
+  kTranspose,
+  kCalcComplements,
+  kDeterminant,
+  kInverse,
+  kHadamard,
+  kKronecker,
+  kPower,
+  kCount  // количество операций, не операция
+};
+
+// счётчики одной операции
+struct S21MatrixOpStats {
+  std::uint64_t calls{0};        // внешние (не рекурсивные) вызовы
+  std::uint64_t flops{0};        // операции с плавающей точкой
+  std::uint64_t bytes{0};        // прочитано и записано элементов, байт
+  std::uint64_t nanoseconds{0};  // время внешних вызовов
+};
+
+// снимок всех счётчиков
+struct S21MatrixStats {
+  std::uint64_t allocations{0};      // вызовы create_matrix
+  std::uint64_t frees{0};            // вызовы remove_matrix
+  std::uint64_t bytes_allocated{0};  // байт выделено под элементы и строки
+  std::uint64_t bytes_freed{0};      // байт освобождено
+  S21MatrixOpStats ops[static_cast<int>(S21MatrixOp::kCount)];
+
+  const S21MatrixOpStats& operator[](S21MatrixOp op) const {
+    return ops[static_cast<int>(op)];
+  }
+};
+
+class S21MatrixProfiler {
+ public:
+  static S21MatrixStats snapshot();  // согласованность между потоками - relaxed
+  static void reset();
+  static std::string to_json(const S21MatrixStats& stats);
+  static const char* op_name(S21MatrixOp op);
+
+  static void count_alloc(std::size_t bytes);
+  static void count_free(std::size_t bytes);
+  static void count_op(S21MatrixOp op, std::uint64_t calls, std::uint64_t flops,
+                       std::uint64_t bytes, std::uint64_t nanoseconds);
+
+  /* замер одного вызова: вложенные вызовы той же операции (рекурсия
+   * determinant) добавляют flops и bytes, но не calls и время */
+  class Scope {
+   public:
+    Scope(S21MatrixOp op, std::uint64_t flops, std::uint64_t bytes);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    S21MatrixOp _op;
+    std::uint64_t _flops;
+    std::uint64_t _bytes;
+    bool _outer;
+    std::chrono::steady_clock::time_point _start;
+  };
+};
+
+#ifdef S21_MATRIX_STATS
+#define S21_STATS_OP(op, flops, bytes)                              \
+  S21MatrixProfiler::Scope s21_stats_scope_(S21MatrixOp::op,         \
+                                            (std::uint64_t)(flops),  \
+                                            (std::uint64_t)(bytes))
+#define S21_STATS_ALLOC(bytes) S21MatrixProfiler::count_alloc(bytes)
+#define S21_STATS_FREE(bytes) S21MatrixProfiler::count_free(bytes)
+#else
+#define S21_STATS_OP(op, flops, bytes) ((void)0)
+#define S21_STATS_ALLOC(bytes) ((void)0)
+#define S21_STATS_FREE(bytes) ((void)0)
+#endif
+
+#endif  // SRC_S21_MATRIX_STATS_H_
@@ -1,8 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include <iostream>
+#include <thread>
 
+#include "s21_matrix_cache.h"
+#include "s21_matrix_dist.h"
+#include "s21_matrix_io.h"
 #include "s21_matrix_oop.h"
+#include "s21_matrix_stats.h"
 
 void fill_matrix(S21Matrix *matr);
 
@@ -329,6 +337,330 @@ TEST(method, det_calc_comp_invers_err2) {
   EXPECT_THROW(c.inverse_matrix(), std::invalid_argument);
 }
 
+/* ввод-вывод */
+
+TEST(io, parse_csv) {
+  S21Matrix a = S21MatrixIO::parse("1,2,3\n4, 5 ,6\r\n\n");
+  S21Matrix b(2, 3);
+  fill_matrix(&b);
+  EXPECT_EQ(a.get_rows(), 2);
+  EXPECT_EQ(a.get_cols(), 3);
+  EXPECT_TRUE(a == b);
+}
+
+TEST(io, parse_spaces) {
+  S21MatrixFormat format;
+  format.delimiter = ' ';
+  S21Matrix a = S21MatrixIO::parse("  1 2\t3\n4   5 6  \n", format);
+  S21Matrix b(2, 3);
+  fill_matrix(&b);
+  EXPECT_TRUE(a == b);
+}
+
+TEST(io, round_trip) {
+  S21Matrix a(2, 3);
+  double f[]{0.1, 1.0 / 3, -2.5e-300, 1e308, -0.0, 123456789.125};
+  a.set_matrix(f);
+  S21Matrix b = S21MatrixIO::parse(S21MatrixIO::to_string(a));
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 3; j++) {
+      EXPECT_EQ(a(i, j), b(i, j));
+    }
+  }
+  EXPECT_EQ(S21MatrixIO::to_string(a).substr(0, 4), "0.1,");
+}
+
+TEST(io, parse_threads) {
+  S21Matrix a(2000, 7);
+  fill_matrix(&a);
+  a.mul_number(0.37);
+  S21MatrixFormat format;
+  format.threads = 4;
+  S21Matrix b = S21MatrixIO::parse(S21MatrixIO::to_string(a), format);
+  EXPECT_TRUE(a == b);
+  EXPECT_EQ(a(1999, 6), b(1999, 6));
+}
+
+TEST(io, save_load) {
+  S21Matrix a(40, 3);
+  fill_matrix(&a);
+  a.mul_number(1.0 / 7);
+  S21MatrixFormat format;
+  format.delimiter = '\t';
+  S21MatrixIO::save("io_test.tsv", a, format);
+  S21Matrix b = S21MatrixIO::load("io_test.tsv", format);
+  std::remove("io_test.tsv");
+  EXPECT_TRUE(a == b);
+  EXPECT_EQ(a(39, 2), b(39, 2));
+}
+
+TEST(io, parse_err1) {
+  EXPECT_THROW(S21MatrixIO::parse(""), std::invalid_argument);
+  EXPECT_THROW(S21MatrixIO::parse(" \n\n"), std::invalid_argument);
+  EXPECT_THROW(S21MatrixIO::parse("1,2\n3"), std::invalid_argument);
+  EXPECT_THROW(S21MatrixIO::parse("1,2\n3,4,5"), std::invalid_argument);
+  EXPECT_THROW(S21MatrixIO::parse("1,x"), std::invalid_argument);
+  EXPECT_THROW(S21MatrixIO::parse("1,2 3"), std::invalid_argument);
+  EXPECT_THROW(S21MatrixIO::load("no_such_dir/m.csv"), std::invalid_argument);
+}
+
+/* поэлементные операции, кронекерово произведение, степень */
+
+TEST(method, hadamard) {
+  S21Matrix a(2, 3);
+  S21Matrix b(2, 3);
+  fill_matrix(&a);
+  fill_matrix(&b);
+  a.hadamard_mul(b);
+  EXPECT_EQ(a(1, 2), 36);
+  EXPECT_EQ(a(0, 1), 4);
+  a.hadamard_div(b);
+  EXPECT_TRUE(a == b);
+  S21Matrix c(3, 2);
+  EXPECT_THROW(a.hadamard_mul(c), std::invalid_argument);
+  EXPECT_THROW(a.hadamard_div(c), std::invalid_argument);
+}
+
+TEST(method, kronecker) {
+  S21Matrix a(2, 2);
+  S21Matrix b(2, 3);
+  double f_a[]{1, 2, 3, 4};
+  double f_b[]{0, 5, 1, 6, 7, 1};
+  a.set_matrix(f_a);
+  b.set_matrix(f_b);
+  S21Matrix r = a.kronecker(b);
+  S21Matrix r_res(4, 6);
+  double f_r[]{0,  5,  1, 0,  10, 2, 6,  7,  1, 12, 14, 2,
+               0, 15,  3, 0,  20, 4, 18, 21, 3, 24, 28, 4};
+  r_res.set_matrix(f_r);
+  EXPECT_TRUE(r == r_res);
+  S21Matrix out(4, 6);
+  a.kronecker(b, out);
+  EXPECT_TRUE(out == r_res);
+  EXPECT_THROW(a.kronecker(b, a), std::invalid_argument);
+}
+
+TEST(method, power) {
+  S21Matrix a(2, 2);
+  double f[]{1, 1, 1, 0};  // числа Фибоначчи
+  a.set_matrix(f);
+  EXPECT_EQ(a.power(64)(0, 1), 10610209857723.0);
+  EXPECT_EQ(a.power(45)(0, 1), 1134903170.0);
+  EXPECT_EQ(a.power(1)(0, 0), 1);
+  S21Matrix b(3, 3);
+  fill_matrix(&b);
+  S21Matrix b7 = b * b * b * b * b * b * b;
+  EXPECT_TRUE(b.power(7) == b7);
+  S21Matrix e(3, 3);
+  double f_e[]{1, 0, 0, 0, 1, 0, 0, 0, 1};
+  e.set_matrix(f_e);
+  EXPECT_TRUE(b.power(0) == e);
+  EXPECT_THROW(b.power(-1), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(2, 3).power(2), std::invalid_argument);
+}
+
+/* кэш результатов */
+
+TEST(cache, hit_miss) {
+  S21MatrixCache cache;
+  S21Matrix a(3, 3);
+  double f[]{2, 5, 7, 6, 3, 4, 5, -2, -3};
+  a.set_matrix(f);
+  S21Matrix b(a);
+  EXPECT_EQ(cache.determinant(a), -1);
+  EXPECT_EQ(cache.determinant(b), -1);
+  EXPECT_TRUE(cache.inverse_matrix(a) == a.inverse_matrix());
+  EXPECT_TRUE(cache.inverse_matrix(b) == a.inverse_matrix());
+  EXPECT_TRUE(cache.calc_complements(b) == a.calc_complements());
+  S21MatrixCache::Stats stats = cache.stats();
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(stats.misses, 3u);
+  EXPECT_EQ(stats.entries, 3u);
+  b(0, 0) = 3;
+  EXPECT_EQ(cache.determinant(b), a.determinant() + b.calc_complements()(0, 0));
+  EXPECT_EQ(cache.stats().misses, 4u);
+}
+
+TEST(cache, hash) {
+  S21Matrix a(5, 7);
+  fill_matrix(&a);
+  S21Matrix b(a);
+  S21Matrix c(7, 5);
+  fill_matrix(&c);
+  EXPECT_EQ(S21MatrixCache::hash(a), S21MatrixCache::hash(b));
+  EXPECT_NE(S21MatrixCache::hash(a), S21MatrixCache::hash(c));
+  b(4, 6) += 1e-14;  // различие меньше EPS, но не побитовое
+  EXPECT_NE(S21MatrixCache::hash(a), S21MatrixCache::hash(b));
+}
+
+TEST(cache, eviction) {
+  S21MatrixCache cache(2000);
+  S21Matrix a(2, 2);
+  a(1, 1) = 1;
+  for (int i = 0; i < 20; i++) {
+    a(0, 0) = i + 1;
+    cache.inverse_matrix(a);
+    EXPECT_LE(cache.stats().bytes, 2000u);
+  }
+  S21MatrixCache::Stats stats = cache.stats();
+  EXPECT_GT(stats.evictions, 0u);
+  EXPECT_EQ(stats.evictions + stats.entries, 20u);
+  cache.set_max_bytes(0);
+  EXPECT_EQ(cache.stats().entries, 0u);
+  a(0, 0) = 0;
+  EXPECT_THROW(cache.inverse_matrix(a), std::invalid_argument);
+  EXPECT_EQ(cache.stats().entries, 0u);
+}
+
+/* распределённое умножение */
+
+TEST(dist, local_threads) {
+  S21Matrix a(7, 5), b(5, 6);
+  fill_matrix(&a);
+  fill_matrix(&b);
+  S21Matrix expected = a * b;
+  S21Matrix result(1, 1);
+  S21ProcessGrid grid{2, 2, 2};
+  auto transports = S21LocalTransport::create(4);
+  std::vector<std::thread> ranks;
+  for (int r = 0; r < 4; r++) {
+    ranks.emplace_back([&, r]() {
+      S21Transport &t = *transports[r];
+      S21DistMatrix da(t, 7, 5, grid), db(t, 5, 6, grid), dc(t, 7, 6, grid);
+      da.scatter(r == 0 ? &a : NULL);
+      db.load(b);
+      S21DistMatrix::multiply(da, db, dc);
+      dc.gather(r == 0 ? &result : NULL);
+    });
+  }
+  for (std::thread &rank : ranks) rank.join();
+  EXPECT_TRUE(result == expected);
+  EXPECT_THROW(S21DistMatrix(*transports[0], 2, 2, S21ProcessGrid{1, 3, 2}),
+               std::invalid_argument);
+}
+
+TEST(dist, ranks_without_columns) {
+  // решётка 1x3 и блок 64: все столбцы 3x3 у ранга 0, у остальных пусто
+  S21Matrix a(3, 3), b(3, 3);
+  fill_matrix(&a);
+  fill_matrix(&b);
+  S21Matrix expected = a * b;
+  S21Matrix result(1, 1);
+  S21ProcessGrid grid{1, 3, 64};
+  auto transports = S21LocalTransport::create(3);
+  std::vector<std::thread> ranks;
+  for (int r = 0; r < 3; r++) {
+    ranks.emplace_back([&, r]() {
+      S21Transport &t = *transports[r];
+      S21DistMatrix da(t, 3, 3, grid), db(t, 3, 3, grid), dc(t, 3, 3, grid);
+      da.load(a);
+      db.load(b);
+      S21DistMatrix::multiply(da, db, dc);
+      dc.gather(r == 0 ? &result : NULL);
+    });
+  }
+  for (std::thread &rank : ranks) rank.join();
+  EXPECT_TRUE(result == expected);
+}
+
+TEST(dist, socket_processes) {
+  S21Matrix a(9, 4), b(4, 10);
+  fill_matrix(&a);
+  fill_matrix(&b);
+  b.mul_number(-0.5);
+  S21Matrix expected = a * b;
+  S21ProcessGrid grid{2, 2, 3};
+  S21SocketTransport::Mesh mesh = S21SocketTransport::make_mesh(4);
+  std::vector<pid_t> children;
+  for (int r = 1; r < 4; r++) {
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+      int code = 0;
+      try {
+        S21SocketTransport t(r, mesh);
+        S21DistMatrix da(t, 9, 4, grid), db(t, 4, 10, grid), dc(t, 9, 10, grid);
+        da.scatter(NULL);
+        db.scatter(NULL);
+        S21DistMatrix::multiply(da, db, dc);
+        dc.gather(NULL);
+      } catch (...) {
+        code = 1;
+      }
+      _exit(code);
+    }
+    children.push_back(pid);
+  }
+  S21Matrix result(1, 1);
+  {
+    S21SocketTransport t(0, mesh);
+    S21DistMatrix da(t, 9, 4, grid), db(t, 4, 10, grid), dc(t, 9, 10, grid);
+    da.scatter(&a);
+    db.scatter(&b);
+    S21DistMatrix::multiply(da, db, dc);
+    dc.gather(&result);
+  }
+  for (pid_t pid : children) {
+    int status = 0;
+    waitpid(pid, &status, 0);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  }
+  EXPECT_TRUE(result == expected);
+}
+
+/* счётчики операций */
+
+TEST(stats, json) {
+  S21MatrixStats stats;
+  stats.allocations = 3;
+  std::string json = S21MatrixProfiler::to_json(stats);
+  EXPECT_EQ(json.find("{\"allocations\":3,"), 0u);
+  EXPECT_NE(json.find("\"mul_matrix\":{\"calls\":0,"), std::string::npos);
+  EXPECT_EQ(json.back(), '}');
+}
+
+#ifdef S21_MATRIX_STATS
+TEST(stats, counters) {
+  S21MatrixProfiler::reset();
+  {
+    S21Matrix a(3, 3);
+    S21Matrix b(3, 2);
+    fill_matrix(&a);
+    a.mul_matrix(b);
+    a.transpose();
+  }
+  S21MatrixStats stats = S21MatrixProfiler::snapshot();
+  EXPECT_EQ(stats[S21MatrixOp::kMulMatrix].calls, 1u);
+  EXPECT_EQ(stats[S21MatrixOp::kMulMatrix].flops, 2u * 3 * 3 * 2);
+  EXPECT_EQ(stats[S21MatrixOp::kTranspose].calls, 1u);
+  EXPECT_EQ(stats.allocations, 4u);  // a, b, результат mul, результат transpose
+  EXPECT_EQ(stats.allocations, stats.frees);
+  EXPECT_EQ(stats.bytes_allocated, stats.bytes_freed);
+}
+
+TEST(stats, recursion) {
+  S21Matrix a(4, 4);
+  fill_matrix(&a);
+  S21MatrixProfiler::reset();
+  a.determinant();
+  S21MatrixStats stats = S21MatrixProfiler::snapshot();
+  EXPECT_EQ(stats[S21MatrixOp::kDeterminant].calls, 1u);
+  // миноры 4x4 -> 4 по 3x3 -> 12 по 2x2, по 2 flops на слагаемое разложения
+  EXPECT_EQ(stats[S21MatrixOp::kDeterminant].flops, 2u * (4 + 4 * 3 + 12 * 2));
+}
+
+TEST(stats, power) {
+  S21Matrix a(4, 4);
+  fill_matrix(&a);
+  S21MatrixProfiler::reset();
+  a.power(64);
+  S21MatrixStats stats = S21MatrixProfiler::snapshot();
+  EXPECT_EQ(stats[S21MatrixOp::kPower].calls, 1u);
+  EXPECT_EQ(stats[S21MatrixOp::kMulMatrix].calls, 6u);
+  EXPECT_EQ(stats.allocations, 2u);  // base и scratch
+}
+#endif  // S21_MATRIX_STATS
+
 /* other */
 
 TEST(other, print_test) {
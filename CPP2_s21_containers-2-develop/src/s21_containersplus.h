@@ -1,5 +1,11 @@
 #ifndef CPP2_S21_CONTAINERS_1_SRC_S21_CONTAINERSPLUS_H_
 #define CPP2_S21_CONTAINERS_1_SRC_S21_CONTAINERSPLUS_H_
 #include "s21_array/s21_array.hpp"
+#include "s21_deque/s21_deque.h"
+#include "s21_list/s21_intrusive_list.h"
 #include "s21_list/s21_list.h"
+#include "s21_lockfree_queue/s21_lockfree_queue.h"
+#include "s21_ring_buffer/s21_ring_buffer.h"
+#include "s21_scheduler/s21_scheduler.h"
+#include "s21_small_vector/s21_small_vector.h"
 #endif  // CPP2_S21_CONTAINERS_1_SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
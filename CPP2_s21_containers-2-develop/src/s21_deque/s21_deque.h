@@ -0,0 +1,463 @@
+#ifndef S21_DEQUE_S21_DEQUE_H_
+#define S21_DEQUE_S21_DEQUE_H_
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace s21 {
+
+// Двусторонняя очередь из блоков фиксированного размера. Карта хранит
+// указатели на блоки; при росте переносятся только указатели, поэтому
+// ссылки на элементы не меняются при вставке в начало и в конец.
+// Элемент с номером i лежит в позиции start_ + i сквозной нумерации блоков.
+template <typename T>
+class deque {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  template <bool Const>
+  class DequeIterator;
+  using iterator = DequeIterator<false>;
+  using const_iterator = DequeIterator<true>;
+
+  deque();
+  deque(std::initializer_list<value_type> const &items);
+  deque(const deque &other);
+  deque(deque &&other) noexcept;
+  ~deque();
+  deque &operator=(const deque &other);
+  deque &operator=(deque &&other) noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  iterator erase(iterator pos);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  template <typename... Args>
+  reference emplace_front(Args &&...args);
+  void pop_back();
+  void pop_front();
+  void swap(deque &other) noexcept;
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  // около 512 байт на блок, но не меньше 8 элементов
+  static constexpr size_type kBlockSize =
+      sizeof(T) < 64 ? 512 / sizeof(T) : 8;
+  static constexpr size_type kMinMapSize = 8;
+
+  T *block_for(size_type pos);
+  void release_block(size_type pos);
+  void reserve_map(bool at_front);
+
+  T **map_;
+  size_type map_size_;
+  size_type start_;
+  size_type size_;
+};
+
+template <typename T>
+template <bool Const>
+class deque<T>::DequeIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T *, T *>;
+  using reference = std::conditional_t<Const, const T &, T &>;
+  using owner = std::conditional_t<Const, const deque, deque>;
+
+  DequeIterator() : container(nullptr), index(0) {}
+  DequeIterator(owner *container, size_type index)
+      : container(container), index(index) {}
+  operator DequeIterator<true>() const { return {container, index}; }
+
+  reference operator*() const { return (*container)[index]; }
+  pointer operator->() const { return &(*container)[index]; }
+  reference operator[](difference_type n) const {
+    return (*container)[index + n];
+  }
+
+  DequeIterator &operator++() {
+    ++index;
+    return *this;
+  }
+  DequeIterator operator++(int) {
+    DequeIterator copy = *this;
+    ++index;
+    return copy;
+  }
+  DequeIterator &operator--() {
+    --index;
+    return *this;
+  }
+  DequeIterator operator--(int) {
+    DequeIterator copy = *this;
+    --index;
+    return copy;
+  }
+  DequeIterator &operator+=(difference_type n) {
+    index += n;
+    return *this;
+  }
+  DequeIterator &operator-=(difference_type n) {
+    index -= n;
+    return *this;
+  }
+  DequeIterator operator+(difference_type n) const {
+    return DequeIterator(container, index + n);
+  }
+  DequeIterator operator-(difference_type n) const {
+    return DequeIterator(container, index - n);
+  }
+  difference_type operator-(const DequeIterator &other) const {
+    return static_cast<difference_type>(index) -
+           static_cast<difference_type>(other.index);
+  }
+
+  bool operator==(const DequeIterator &other) const {
+    return container == other.container && index == other.index;
+  }
+  bool operator!=(const DequeIterator &other) const {
+    return !(*this == other);
+  }
+  bool operator<(const DequeIterator &other) const {
+    return index < other.index;
+  }
+  bool operator>(const DequeIterator &other) const { return other < *this; }
+  bool operator<=(const DequeIterator &other) const {
+    return !(other < *this);
+  }
+  bool operator>=(const DequeIterator &other) const {
+    return !(*this < other);
+  }
+
+ private:
+  friend class deque;
+
+  owner *container;
+  size_type index;  // логический номер элемента от начала
+};
+
+template <typename T>
+inline deque<T>::deque()
+    : map_(nullptr), map_size_(0), start_(0), size_(0) {}
+
+template <typename T>
+inline deque<T>::deque(std::initializer_list<value_type> const &items)
+    : deque() {
+  for (const auto &item : items) push_back(item);
+}
+
+template <typename T>
+inline deque<T>::deque(const deque &other) : deque() {
+  for (const auto &item : other) push_back(item);
+}
+
+template <typename T>
+inline deque<T>::deque(deque &&other) noexcept : deque() {
+  swap(other);
+}
+
+template <typename T>
+inline deque<T>::~deque() {
+  clear();
+  if (map_) std::allocator<T *>().deallocate(map_, map_size_);
+}
+
+template <typename T>
+inline deque<T> &deque<T>::operator=(const deque &other) {
+  if (this != &other) {
+    deque copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename T>
+inline deque<T> &deque<T>::operator=(deque &&other) noexcept {
+  if (this != &other) {
+    deque moved(std::move(other));
+    swap(moved);
+  }
+  return *this;
+}
+
+template <typename T>
+inline typename deque<T>::reference deque<T>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out range");
+  }
+  return (*this)[pos];
+}
+
+template <typename T>
+inline typename deque<T>::const_reference deque<T>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out range");
+  }
+  return (*this)[pos];
+}
+
+template <typename T>
+inline typename deque<T>::reference deque<T>::operator[](size_type pos) {
+  pos += start_;
+  return map_[pos / kBlockSize][pos % kBlockSize];
+}
+
+template <typename T>
+inline typename deque<T>::const_reference deque<T>::operator[](
+    size_type pos) const {
+  pos += start_;
+  return map_[pos / kBlockSize][pos % kBlockSize];
+}
+
+template <typename T>
+inline typename deque<T>::reference deque<T>::front() {
+  return (*this)[0];
+}
+
+template <typename T>
+inline typename deque<T>::const_reference deque<T>::front() const {
+  return (*this)[0];
+}
+
+template <typename T>
+inline typename deque<T>::reference deque<T>::back() {
+  return (*this)[size_ - 1];
+}
+
+template <typename T>
+inline typename deque<T>::const_reference deque<T>::back() const {
+  return (*this)[size_ - 1];
+}
+
+template <typename T>
+inline typename deque<T>::iterator deque<T>::begin() {
+  return iterator(this, 0);
+}
+
+template <typename T>
+inline typename deque<T>::iterator deque<T>::end() {
+  return iterator(this, size_);
+}
+
+template <typename T>
+inline typename deque<T>::const_iterator deque<T>::begin() const {
+  return const_iterator(this, 0);
+}
+
+template <typename T>
+inline typename deque<T>::const_iterator deque<T>::end() const {
+  return const_iterator(this, size_);
+}
+
+template <typename T>
+inline bool deque<T>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T>
+inline typename deque<T>::size_type deque<T>::size() const {
+  return size_;
+}
+
+template <typename T>
+inline typename deque<T>::size_type deque<T>::max_size() const {
+  return std::numeric_limits<std::size_t>::max() / sizeof(value_type) / 2;
+}
+
+// Блоки освобождаются по мере опустошения, карта остается
+template <typename T>
+inline void deque<T>::clear() {
+  while (size_) pop_back();
+}
+
+// Сдвигается меньшая из двух частей, как в ring_buffer
+template <typename T>
+inline typename deque<T>::iterator deque<T>::erase(iterator pos) {
+  size_type index = pos.index;
+  if (index >= size_) {
+    throw std::out_of_range("Index out ot range");
+  }
+  if (index < size_ / 2) {
+    for (size_type i = index; i > 0; --i) {
+      (*this)[i] = std::move((*this)[i - 1]);
+    }
+    pop_front();
+  } else {
+    for (size_type i = index; i + 1 < size_; ++i) {
+      (*this)[i] = std::move((*this)[i + 1]);
+    }
+    pop_back();
+  }
+  return iterator(this, index);
+}
+
+template <typename T>
+inline void deque<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T>
+inline void deque<T>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T>
+inline void deque<T>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T>
+inline void deque<T>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+// Указатель на ячейку позиции pos; блок выделяется при первом обращении
+template <typename T>
+inline T *deque<T>::block_for(size_type pos) {
+  T *&block = map_[pos / kBlockSize];
+  if (!block) block = std::allocator<T>().allocate(kBlockSize);
+  return block + pos % kBlockSize;
+}
+
+// Освобождает блок позиции pos, если в нем не осталось элементов
+template <typename T>
+inline void deque<T>::release_block(size_type pos) {
+  size_type first = start_, last = start_ + size_;
+  size_type block = pos / kBlockSize;
+  if (size_ == 0 || first / kBlockSize > block ||
+      (last - 1) / kBlockSize < block) {
+    std::allocator<T>().deallocate(map_[block], kBlockSize);
+    map_[block] = nullptr;
+  }
+}
+
+template <typename T>
+template <typename... Args>
+inline typename deque<T>::reference deque<T>::emplace_back(Args &&...args) {
+  if ((start_ + size_) / kBlockSize >= map_size_) reserve_map(false);
+  size_type pos = start_ + size_;
+  T *cell = block_for(pos);
+  try {
+    ::new (static_cast<void *>(cell)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    release_block(pos);
+    throw;
+  }
+  ++size_;
+  return *cell;
+}
+
+template <typename T>
+template <typename... Args>
+inline typename deque<T>::reference deque<T>::emplace_front(Args &&...args) {
+  if (start_ == 0) reserve_map(true);
+  size_type pos = start_ - 1;
+  T *cell = block_for(pos);
+  try {
+    ::new (static_cast<void *>(cell)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    release_block(pos);
+    throw;
+  }
+  start_ = pos;
+  ++size_;
+  return *cell;
+}
+
+template <typename T>
+inline void deque<T>::pop_back() {
+  size_type pos = start_ + size_ - 1;
+  (*this)[size_ - 1].~T();
+  --size_;
+  release_block(pos);
+}
+
+template <typename T>
+inline void deque<T>::pop_front() {
+  size_type pos = start_;
+  (*this)[0].~T();
+  ++start_;
+  --size_;
+  release_block(pos);
+}
+
+template <typename T>
+inline void deque<T>::swap(deque &other) noexcept {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+}
+
+// Освобождает в карте место под блок с нужной стороны. Занятые блоки
+// ставятся по центру: если карта заполнена меньше чем наполовину, сдвиг
+// идет на месте, иначе карта вдвое увеличивается. Сами элементы не
+// перемещаются.
+template <typename T>
+inline void deque<T>::reserve_map(bool at_front) {
+  size_type first = start_ / kBlockSize;
+  size_type used = size_ ? (start_ + size_ - 1) / kBlockSize - first + 1 : 0;
+  size_type needed = used + 1;
+  T **map = map_;
+  size_type map_size = map_size_;
+  if (map_size_ < 2 * needed) {
+    map_size = std::max({kMinMapSize, 2 * map_size_, 2 * needed});
+    map = std::allocator<T *>().allocate(map_size);
+  }
+  size_type new_first = (map_size - needed) / 2 + (at_front ? 1 : 0);
+  if (used) {
+    std::memmove(map + new_first, map_ + first, used * sizeof(T *));
+  }
+  std::fill(map, map + new_first, nullptr);
+  std::fill(map + new_first + used, map + map_size, nullptr);
+  if (map != map_) {
+    if (map_) std::allocator<T *>().deallocate(map_, map_size_);
+    map_ = map;
+    map_size_ = map_size;
+  }
+  start_ = new_first * kBlockSize + start_ % kBlockSize;
+}
+
+template <typename T>
+template <typename... Args>
+inline void deque<T>::insert_many_back(Args &&...args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+}  // namespace s21
+
+#endif  // S21_DEQUE_S21_DEQUE_H_
@@ -0,0 +1,83 @@
+#include "s21_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <string>
+
+#include "../s21_queue/s21_queue.h"
+#include "../s21_stack/s21_stack.h"
+#include "../tests.cpp"
+
+TEST(deque, references_stay_valid) {
+  s21::deque<std::string> d{"middle"};
+  std::string *middle = &d.front();
+  for (int i = 0; i < 5000; ++i) {
+    d.push_back(std::to_string(i));
+    d.push_front(std::to_string(-i));
+  }
+  EXPECT_EQ(middle, &d[5000]);
+  EXPECT_EQ(*middle, "middle");
+  EXPECT_EQ(d.size(), 10001U);
+  EXPECT_EQ(d.front(), "-4999");
+  EXPECT_EQ(d.back(), "4999");
+}
+
+TEST(deque, matches_std_deque) {
+  s21::deque<int> d;
+  std::deque<int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    switch (i % 5) {
+      case 0:
+      case 1:
+        d.push_back(i);
+        expected.push_back(i);
+        break;
+      case 2:
+        d.push_front(i);
+        expected.push_front(i);
+        break;
+      case 3:
+        d.pop_front();
+        expected.pop_front();
+        break;
+      default:
+        d.erase(d.begin() + d.size() / 3);
+        expected.erase(expected.begin() + expected.size() / 3);
+    }
+  }
+  ASSERT_EQ(d.size(), expected.size());
+  EXPECT_TRUE(std::equal(d.begin(), d.end(), expected.begin()));
+  EXPECT_EQ(d.end() - d.begin(), long(expected.size()));
+  EXPECT_THROW(d.at(d.size()), std::out_of_range);
+}
+
+TEST(deque, drain_and_reuse) {
+  s21::deque<std::string> d;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 1000; ++i) d.emplace_back(3, 'a' + round);
+    while (d.size() > 1) d.pop_front();
+    EXPECT_EQ(d.front(), std::string(3, 'a' + round));
+    d.clear();
+    EXPECT_TRUE(d.empty());
+  }
+  d.emplace_front("x");
+  s21::deque<std::string> copy(d);
+  s21::deque<std::string> moved(std::move(d));
+  EXPECT_TRUE(d.empty());
+  EXPECT_EQ(copy.front(), "x");
+  EXPECT_EQ(moved.back(), "x");
+}
+
+TEST(deque, as_stack_and_queue_storage) {
+  s21::stack<int, s21::deque<int>> s{1, 2, 3};
+  s.push(4);
+  EXPECT_EQ(s.top(), 4);
+  s.pop();
+  EXPECT_EQ(s.top(), 3);
+  s21::queue<std::string, s21::deque<std::string>> q{"x", "y"};
+  q.push("z");
+  q.pop();
+  EXPECT_EQ(q.front(), "y");
+  EXPECT_EQ(q.back(), "z");
+}
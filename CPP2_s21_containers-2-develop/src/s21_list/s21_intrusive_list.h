@@ -0,0 +1,330 @@
+#ifndef S21_LIST_S21_INTRUSIVE_LIST_H_
+#define S21_LIST_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+template <typename T, typename Tag>
+class intrusive_list;
+
+// Звено интрузивного списка, встраивается в объект наследованием.
+// Tag позволяет держать один объект сразу в нескольких списках:
+//   struct Job : intrusive_list_hook<LruTag>, intrusive_list_hook<RunTag> {};
+// Копия звена не связана ни с каким списком.
+template <typename Tag = void>
+class intrusive_list_hook {
+ public:
+  intrusive_list_hook() = default;
+  intrusive_list_hook(const intrusive_list_hook&) noexcept {}
+  intrusive_list_hook& operator=(const intrusive_list_hook&) noexcept {
+    return *this;
+  }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+ private:
+  template <typename, typename>
+  friend class intrusive_list;
+
+  intrusive_list_hook* next_ = nullptr;
+  intrusive_list_hook* prev_ = nullptr;
+};
+
+// Двусвязный список объектов, которые сами хранят звенья. Список не владеет
+// элементами и ничего не выделяет: вставка и удаление только перевешивают
+// указатели. Объект должен жить, пока он в списке; удалить его из списка
+// можно за O(1) через iterator_to.
+template <typename T, typename Tag = void>
+class intrusive_list {
+  using Hook = intrusive_list_hook<Tag>;
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  template <bool Const>
+  class IntrusiveIterator;
+  using iterator = IntrusiveIterator<false>;
+  using const_iterator = IntrusiveIterator<true>;
+
+  intrusive_list() noexcept { reset(); }
+  intrusive_list(const intrusive_list&) = delete;
+  intrusive_list(intrusive_list&& other) noexcept : intrusive_list() {
+    swap(other);
+  }
+  ~intrusive_list() { clear(); }
+  intrusive_list& operator=(const intrusive_list&) = delete;
+  intrusive_list& operator=(intrusive_list&& other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  reference front();
+  reference back();
+  const_reference front() const;
+  const_reference back() const;
+
+  iterator begin() noexcept { return iterator(root_.next_); }
+  iterator end() noexcept { return iterator(&root_); }
+  const_iterator begin() const noexcept { return const_iterator(root_.next_); }
+  const_iterator end() const noexcept { return const_iterator(&root_); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  static iterator iterator_to(reference value) noexcept {
+    return iterator(hook_of(value));
+  }
+  static const_iterator iterator_to(const_reference value) noexcept {
+    return const_iterator(hook_of(value));
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  iterator insert(const_iterator pos, reference value);
+  iterator erase(const_iterator pos);
+  void push_back(reference value) { insert(cend(), value); }
+  void push_front(reference value) { insert(cbegin(), value); }
+  void pop_back();
+  void pop_front();
+  void splice(const_iterator pos, intrusive_list& other) noexcept;
+  void splice(const_iterator pos, intrusive_list& other,
+              const_iterator it) noexcept;
+  void clear() noexcept;
+  void swap(intrusive_list& other) noexcept;
+
+ private:
+  static Hook* hook_of(reference value) noexcept {
+    return static_cast<Hook*>(std::addressof(value));
+  }
+  static const Hook* hook_of(const_reference value) noexcept {
+    return static_cast<const Hook*>(std::addressof(value));
+  }
+  static void link_before(Hook* pos, Hook* hook) noexcept {
+    hook->next_ = pos;
+    hook->prev_ = pos->prev_;
+    pos->prev_->next_ = hook;
+    pos->prev_ = hook;
+  }
+  static void unlink(Hook* hook) noexcept {
+    hook->prev_->next_ = hook->next_;
+    hook->next_->prev_ = hook->prev_;
+  }
+  void reset() noexcept {
+    root_.next_ = root_.prev_ = &root_;
+    size_ = 0;
+  }
+  // Направляет крайние элементы на собственный корень после обмена
+  void adopt_root() noexcept {
+    if (size_ == 0) {
+      reset();
+    } else {
+      root_.next_->prev_ = &root_;
+      root_.prev_->next_ = &root_;
+    }
+  }
+
+  Hook root_;
+  size_type size_ = 0;
+};
+
+template <typename T, typename Tag>
+template <bool Const>
+class intrusive_list<T, Tag>::IntrusiveIterator {
+  using HookPtr = std::conditional_t<Const, const Hook*, Hook*>;
+
+ public:
+  using value_type = T;
+  using reference = std::conditional_t<Const, const T&, T&>;
+  using pointer = std::conditional_t<Const, const T*, T*>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  IntrusiveIterator() = default;
+  explicit IntrusiveIterator(HookPtr hook) : hook_(hook) {}
+  template <bool C = Const, typename = std::enable_if_t<C>>
+  IntrusiveIterator(const IntrusiveIterator<false>& other)
+      : hook_(other.hook_) {}
+
+  reference operator*() const { return static_cast<reference>(*hook_); }
+  pointer operator->() const { return std::addressof(**this); }
+
+  IntrusiveIterator& operator++() {
+    hook_ = hook_->next_;
+    return *this;
+  }
+  IntrusiveIterator operator++(int) {
+    IntrusiveIterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+  IntrusiveIterator& operator--() {
+    hook_ = hook_->prev_;
+    return *this;
+  }
+  IntrusiveIterator operator--(int) {
+    IntrusiveIterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  bool operator==(const IntrusiveIterator& other) const {
+    return hook_ == other.hook_;
+  }
+  bool operator!=(const IntrusiveIterator& other) const {
+    return hook_ != other.hook_;
+  }
+
+ private:
+  friend class intrusive_list;
+  friend class IntrusiveIterator<!Const>;
+
+  Hook* mutable_hook() const { return const_cast<Hook*>(hook_); }
+
+  HookPtr hook_ = nullptr;
+};
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::reference intrusive_list<T, Tag>::front() {
+  if (empty()) {
+    throw std::out_of_range("List is empty");
+  }
+  return *begin();
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::reference intrusive_list<T, Tag>::back() {
+  if (empty()) {
+    throw std::out_of_range("List is empty");
+  }
+  return *--end();
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::const_reference intrusive_list<T, Tag>::front()
+    const {
+  if (empty()) {
+    throw std::out_of_range("List is empty");
+  }
+  return *begin();
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::const_reference intrusive_list<T, Tag>::back()
+    const {
+  if (empty()) {
+    throw std::out_of_range("List is empty");
+  }
+  return *--end();
+}
+
+// Объект может состоять только в одном списке с данным Tag
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::insert(
+    const_iterator pos, reference value) {
+  static_assert(std::is_base_of_v<Hook, T>,
+                "T must derive from intrusive_list_hook<Tag>");
+  Hook* hook = hook_of(value);
+  if (hook->is_linked()) {
+    throw std::invalid_argument("Element is already linked");
+  }
+  link_before(pos.mutable_hook(), hook);
+  ++size_;
+  return iterator(hook);
+}
+
+// Отвязывает элемент и возвращает следующий; сам объект не разрушается
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::erase(
+    const_iterator pos) {
+  Hook* hook = pos.mutable_hook();
+  if (hook == nullptr || hook == &root_) {
+    throw std::out_of_range("Iterator is out of range");
+  }
+  Hook* next = hook->next_;
+  unlink(hook);
+  hook->next_ = hook->prev_ = nullptr;
+  --size_;
+  return iterator(next);
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::pop_back() {
+  if (empty()) {
+    throw std::out_of_range("List is empty");
+  }
+  erase(--cend());
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::pop_front() {
+  if (empty()) {
+    throw std::out_of_range("List is empty");
+  }
+  erase(cbegin());
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::splice(const_iterator pos,
+                                    intrusive_list& other) noexcept {
+  if (this == &other || other.empty()) return;
+  Hook* node = pos.mutable_hook();
+  Hook* first = other.root_.next_;
+  Hook* last = other.root_.prev_;
+  first->prev_ = node->prev_;
+  node->prev_->next_ = first;
+  last->next_ = node;
+  node->prev_ = last;
+  size_ += other.size_;
+  other.reset();
+}
+
+// Переносит один элемент it из other (или из этого же списка) перед pos.
+// Для LRU: splice(cbegin(), *this, iterator_to(x)) поднимает x в начало.
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::splice(const_iterator pos, intrusive_list& other,
+                                    const_iterator it) noexcept {
+  Hook* node = pos.mutable_hook();
+  Hook* hook = it.mutable_hook();
+  if (node == hook || node == hook->next_) return;
+  unlink(hook);
+  link_before(node, hook);
+  --other.size_;
+  ++size_;
+}
+
+// Отвязывает все элементы, чтобы их звенья снова были свободны
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::clear() noexcept {
+  Hook* hook = root_.next_;
+  while (hook != &root_) {
+    Hook* next = hook->next_;
+    hook->next_ = hook->prev_ = nullptr;
+    hook = next;
+  }
+  reset();
+}
+
+// Корни лежат внутри объектов списков, поэтому соседи корней перевешиваются
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::swap(intrusive_list& other) noexcept {
+  if (this == &other) return;
+  std::swap(root_.next_, other.root_.next_);
+  std::swap(root_.prev_, other.root_.prev_);
+  std::swap(size_, other.size_);
+  adopt_root();
+  other.adopt_root();
+}
+
+}  // namespace s21
+
+#endif  // S21_LIST_S21_INTRUSIVE_LIST_H_
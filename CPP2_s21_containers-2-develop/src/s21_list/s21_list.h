@@ -1,13 +1,27 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_tree/s21_node_pool.hpp"
 
 namespace s21 {
 
-template <typename T>
+// Двусвязный список с кольцевым сторожевым узлом end_node: end_node->next -
+// первый элемент, end_node->prev - последний. Итератор - один указатель,
+// переход с end() в обе стороны и вставка в конец - O(1). Для
+// арифметических T сторож хранит размер, поэтому *end() == size(), как у
+// std::list.
+// Узлы берутся из собственного пула списка (NodePool поверх Allocator):
+// освобожденные узлы переиспользуются без обращения к аллокатору.
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   // Member types
@@ -15,63 +29,94 @@ class list {
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
+  using allocator_type = Allocator;
   class ListIterator;
   class ListConstIterator;
   using iterator = ListIterator;
   using const_iterator = ListConstIterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
  private:
   struct Node {
     T data;
     Node* next;
     Node* prev;
-    Node(const T& value) : data(value), next(nullptr), prev(nullptr) {}
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : data(std::forward<Args>(args)...), next(this), prev(this) {}
   };
 
-  Node* head;
-  Node* tail;
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  // Сторож выделяется отдельно от пула: пул может уйти к другому списку
+  // при splice и merge, а сторож остается у своего
+  NodePool<Node, NodeAllocator> pool_;
   Node* end_node;
   size_type size_n;
 
  public:
   // Functions
   list();
+  explicit list(const Allocator& alloc);
   list(size_type n);
   list(std::initializer_list<value_type> const& items);
   list(const list& l);
-  list(list&& l) noexcept;
+  list(list&& l);
   ~list();
   list& operator=(list&& l) noexcept;
 
   // Element access
   const_reference front() const;
   const_reference back() const;
+  reference front();
+  reference back();
 
   // Iterators
   iterator begin();
   iterator end();
   const_iterator cbegin() const;
   const_iterator cend() const;
+  reverse_iterator rbegin();
+  reverse_iterator rend();
+  const_reverse_iterator crbegin() const;
+  const_reverse_iterator crend() const;
 
   // Capacity
   bool empty() const;
   size_type size() const;
   size_type max_size() const;
+  allocator_type get_allocator() const;
 
   // Modifiers
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
   void pop_back();
   void push_front(const_reference value);
+  void push_front(value_type&& value);
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
   void pop_front();
-  void swap(list& other);
+  void swap(list& other) noexcept;
   void merge(list& other);
+  template <typename Compare>
+  void merge(list& other, Compare comp);
   void splice(const iterator pos, list& other);
   void reverse();
   void unique();
   void sort();
+  template <typename Compare>
+  void sort(Compare comp);
 
   // Part 3. insert_many
   template <typename... Args>
@@ -80,12 +125,29 @@ class list {
   void insert_many_back(Args&&... args);
   template <typename... Args>
   void insert_many_front(Args&&... args);
+
+ private:
+  template <typename... Args>
+  Node* create_node(Args&&... args);
+  void destroy_node(Node* node) noexcept;
+  static Node* create_sentinel(const Allocator& alloc);
+  void destroy_sentinel() noexcept;
+
+  void set_size(size_type n);
+  void link_before(Node* pos, Node* node);
+  void unlink(Node* node);
+  Node* detach_chain();
+
+  template <typename Compare>
+  static Node* merge_chains(Node* first, Node* second, Compare& comp);
+  static Node* cut(Node* chain, size_type count);
+  void relink(Node* chain);
 };
 
 // реализация внутреннего класса ListIterator
 
-template <typename T>
-class list<T>::ListIterator {
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListIterator {
  public:
   using value_type = T;
   using reference = T&;
@@ -93,35 +155,14 @@ class list<T>::ListIterator {
   using difference_type = std::ptrdiff_t;
   using iterator_category = std::bidirectional_iterator_tag;
 
-  explicit ListIterator(Node* node, Node* head, Node* end_node, const list* lst)
-      : node(node),
-        head(head),
-        end_node(end_node),
-        lst(lst),
-        special_state(false),
-        list_size(lst->size()) {}
+  ListIterator() : node(nullptr) {}
+  explicit ListIterator(Node* node) : node(node) {}
 
-  ~ListIterator() = default;
-
-  reference operator*() const {
-    if (special_state) {
-      special_value = static_cast<T>(list_size);
-      return special_value;
-    }
-    return node->data;
-  }
-
-  pointer operator->() const { return &(operator*()); }
+  reference operator*() const { return node->data; }
+  pointer operator->() const { return &(node->data); }
 
   ListIterator& operator++() {
-    if (special_state) {
-      special_state = false;
-      node = head;
-    } else if (node->next) {
-      node = node->next;
-    } else {
-      special_state = true;
-    }
+    node = node->next;
     return *this;
   }
 
@@ -132,18 +173,7 @@ class list<T>::ListIterator {
   }
 
   ListIterator& operator--() {
-    if (special_state) {
-      special_state = false;
-      Node* temp = head;
-      while (temp->next) {
-        temp = temp->next;
-      }
-      node = temp;
-    } else if (node->prev) {
-      node = node->prev;
-    } else {
-      special_state = true;
-    }
+    node = node->prev;
     return *this;
   }
 
@@ -154,25 +184,23 @@ class list<T>::ListIterator {
   }
 
   bool operator==(const ListIterator& other) const {
-    return node == other.node && special_state == other.special_state;
+    return node == other.node;
   }
 
   bool operator!=(const ListIterator& other) const { return !(*this == other); }
 
+  operator ListConstIterator() const { return ListConstIterator(node); }
+
+  Node* getNode() const { return node; }
+
  private:
   Node* node;
-  Node* head;
-  Node* end_node;
-  const list* lst;
-  bool special_state;
-  mutable T special_value;
-  size_t list_size;
 };
 
 // реализация внутреннего класса ListConstIterator
 
-template <typename T>
-class list<T>::ListConstIterator {
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListConstIterator {
  public:
   using value_type = T;
   using reference = const T&;
@@ -180,16 +208,14 @@ class list<T>::ListConstIterator {
   using difference_type = std::ptrdiff_t;
   using iterator_category = std::bidirectional_iterator_tag;
 
-  explicit ListConstIterator(const Node* node, const Node* end_node)
-      : node(node), end_node(end_node) {}
+  ListConstIterator() : node(nullptr) {}
+  explicit ListConstIterator(const Node* node) : node(node) {}
 
   reference operator*() const { return node->data; }
   pointer operator->() const { return &(node->data); }
 
   ListConstIterator& operator++() {
-    if (node && node != end_node) {
-      node = node->next ? node->next : end_node;
-    }
+    node = node->next;
     return *this;
   }
 
@@ -200,11 +226,7 @@ class list<T>::ListConstIterator {
   }
 
   ListConstIterator& operator--() {
-    if (node && node != end_node) {
-      node = node->prev ? node->prev : end_node;
-    } else if (node == end_node) {
-      node = end_node->prev;
-    }
+    node = node->prev;
     return *this;
   }
 
@@ -226,54 +248,58 @@ class list<T>::ListConstIterator {
 
  private:
   const Node* node;
-  const Node* end_node;
 };
 
 // Реализация конструкторов и деструктора
 
-template <typename T>
-list<T>::list() : head(nullptr), tail(nullptr), size_n(0) {
-  end_node = new Node(T());
-  end_node->next = nullptr;
-  end_node->prev = tail;
+template <typename T, typename Allocator>
+list<T, Allocator>::list() : list(Allocator()) {}
+
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const Allocator& alloc)
+    : pool_(NodeAllocator(alloc)), end_node(create_sentinel(alloc)), size_n(0) {
+  set_size(0);
 }
 
-template <typename T>
-list<T>::list(size_type n) : list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type n) : list() {
   for (size_type i = 0; i < n; ++i) {
     push_back(T());
   }
 }
 
-template <typename T>
-list<T>::list(std::initializer_list<value_type> const& items) : list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(std::initializer_list<value_type> const& items)
+    : list() {
   for (const auto& item : items) {
     push_back(item);
   }
 }
 
-template <typename T>
-list<T>::list(const list& l) : list() {
-  Node* current = l.head;
-  while (current) {
-    push_back(current->data);
-    current = current->next;
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list& l)
+    : list(std::allocator_traits<Allocator>::
+               select_on_container_copy_construction(l.get_allocator())) {
+  for (const_iterator it = l.cbegin(); it != l.cend(); ++it) {
+    push_back(*it);
   }
 }
 
-template <typename T>
-list<T>::list(list&& l) noexcept : list() {
+// Не noexcept: l остается рабочим пустым списком, и ему нужен новый сторож.
+// Перенос присваиванием ничего не выделяет и не бросает
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list&& l) : list(l.get_allocator()) {
   swap(l);
 }
 
-template <typename T>
-list<T>::~list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::~list() {
   clear();
-  delete end_node;
+  destroy_sentinel();
 }
 
-template <typename T>
-list<T>& list<T>::operator=(list&& l) noexcept {
+template <typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(list&& l) noexcept {
   if (this != &l) {
     clear();
     swap(l);
@@ -281,369 +307,454 @@ list<T>& list<T>::operator=(list&& l) noexcept {
   return *this;
 }
 
+// Вспомогательные методы
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::Node* list<T, Allocator>::create_node(
+    Args&&... args) {
+  void* memory = pool_.allocate();
+  try {
+    return new (memory) Node(std::forward<Args>(args)...);
+  } catch (...) {
+    pool_.deallocate(memory);
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::destroy_node(Node* node) noexcept {
+  node->~Node();
+  pool_.deallocate(node);
+}
+
+template <typename T, typename Allocator>
+typename list<T, Allocator>::Node* list<T, Allocator>::create_sentinel(
+    const Allocator& alloc) {
+  NodeAllocator node_alloc(alloc);
+  Node* node = NodeTraits::allocate(node_alloc, 1);
+  try {
+    NodeTraits::construct(node_alloc, node);
+  } catch (...) {
+    NodeTraits::deallocate(node_alloc, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::destroy_sentinel() noexcept {
+  NodeAllocator node_alloc(pool_.get_allocator());
+  NodeTraits::destroy(node_alloc, end_node);
+  NodeTraits::deallocate(node_alloc, end_node, 1);
+}
+
+// Размер дублируется в данные сторожа, чтобы *end() давал size()
+template <typename T, typename Allocator>
+void list<T, Allocator>::set_size(size_type n) {
+  size_n = n;
+  if constexpr (std::is_arithmetic_v<T>) {
+    end_node->data = static_cast<T>(n);
+  }
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::link_before(Node* pos, Node* node) {
+  node->next = pos;
+  node->prev = pos->prev;
+  pos->prev->next = node;
+  pos->prev = node;
+  set_size(size_n + 1);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::unlink(Node* node) {
+  node->prev->next = node->next;
+  node->next->prev = node->prev;
+  set_size(size_n - 1);
+}
+
+// Размыкает кольцо: возвращает элементы цепочкой по next, оканчивающейся
+// nullptr, и оставляет список пустым (размер не трогает)
+template <typename T, typename Allocator>
+typename list<T, Allocator>::Node* list<T, Allocator>::detach_chain() {
+  if (end_node->next == end_node) return nullptr;
+  Node* chain = end_node->next;
+  end_node->prev->next = nullptr;
+  end_node->next = end_node->prev = end_node;
+  return chain;
+}
+
 // Реализация методов класса list
 
-template <typename T>
-typename list<T>::const_reference list<T>::front() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::front() const {
   if (empty()) {
     throw std::out_of_range("List is empty");
   }
-  return head->data;
+  return end_node->next->data;
 }
 
-template <typename T>
-typename list<T>::const_reference list<T>::back() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::back() const {
   if (empty()) {
     throw std::out_of_range("List is empty");
   }
-  return tail->data;
+  return end_node->prev->data;
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::begin() {
-  return iterator(head, head, end_node, this);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::reference list<T, Allocator>::front() {
+  if (empty()) {
+    throw std::out_of_range("List is empty");
+  }
+  return end_node->next->data;
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::end() {
-  return iterator(end_node, head, end_node, this);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::reference list<T, Allocator>::back() {
+  if (empty()) {
+    throw std::out_of_range("List is empty");
+  }
+  return end_node->prev->data;
 }
 
-template <typename T>
-typename list<T>::const_iterator list<T>::cbegin() const {
-  return const_iterator(head, end_node);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::begin() {
+  return iterator(end_node->next);
 }
 
-template <typename T>
-typename list<T>::const_iterator list<T>::cend() const {
-  return const_iterator(end_node, end_node);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::end() {
+  return iterator(end_node);
 }
 
-template <typename T>
-bool list<T>::empty() const {
-  return size_n == 0;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cbegin() const {
+  return const_iterator(end_node->next);
 }
 
-template <typename T>
-typename list<T>::size_type list<T>::size() const {
-  return size_n;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator list<T, Allocator>::cend() const {
+  return const_iterator(end_node);
 }
 
-template <typename T>
-typename list<T>::size_type list<T>::max_size() const {
-  return std::numeric_limits<size_type>::max();
+template <typename T, typename Allocator>
+typename list<T, Allocator>::reverse_iterator list<T, Allocator>::rbegin() {
+  return reverse_iterator(end());
 }
 
-template <typename T>
-void list<T>::clear() {
-  while (head) {
-    Node* next = head->next;
-    delete head;
-    head = next;
-  }
-  tail = nullptr;
-  size_n = 0;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::reverse_iterator list<T, Allocator>::rend() {
+  return reverse_iterator(begin());
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::insert(
-    iterator pos, typename list<T>::const_reference value) {
-  Node* newNode = new Node(value);
-  Node* current = pos.getNode();
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reverse_iterator
+list<T, Allocator>::crbegin() const {
+  return const_reverse_iterator(cend());
+}
 
-  if (current && current != end_node) {
-    newNode->next = current;
-    newNode->prev = current->prev;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reverse_iterator
+list<T, Allocator>::crend() const {
+  return const_reverse_iterator(cbegin());
+}
 
-    if (current->prev) {
-      current->prev->next = newNode;
-    } else {
-      head = newNode;
-    }
+template <typename T, typename Allocator>
+bool list<T, Allocator>::empty() const {
+  return size_n == 0;
+}
 
-    current->prev = newNode;
-  } else {
-    if (tail) {
-      tail->next = newNode;
-      newNode->prev = tail;
-      tail = newNode;
-    } else {
-      head = tail = newNode;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::size() const {
+  return size_n;
+}
+
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max();
+}
+
+template <typename T, typename Allocator>
+typename list<T, Allocator>::allocator_type list<T, Allocator>::get_allocator()
+    const {
+  return allocator_type(pool_.get_allocator());
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::clear() {
+  Node* node = detach_chain();
+  if (!std::is_trivially_destructible<Node>::value) {
+    while (node) {
+      Node* next = node->next;
+      node->~Node();
+      node = next;
     }
   }
+  pool_.release();  // память всех узлов - одним проходом по блокам пула
+  set_size(0);
+}
 
-  ++size_n;
-  return iterator(newNode, end_node);
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(
+    iterator pos, typename list<T, Allocator>::const_reference value) {
+  return emplace(pos, value);
 }
 
-template <typename T>
-void list<T>::erase(iterator pos) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(
+    iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::iterator list<T, Allocator>::emplace(
+    const_iterator pos, Args&&... args) {
+  Node* newNode = create_node(std::forward<Args>(args)...);
+  link_before(const_cast<Node*>(pos.getNode()), newNode);
+  return iterator(newNode);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::erase(iterator pos) {
   Node* node = pos.getNode();
   if (node == nullptr || node == end_node) {
     throw std::out_of_range("Iterator is out of range");
   }
-  if (node->prev) {
-    node->prev->next = node->next;
-  } else {
-    head = node->next;
-  }
+  unlink(node);
+  destroy_node(node);
+}
 
-  if (node->next) {
-    node->next->prev = node->prev;
-  } else {
-    tail = node->prev;
-  }
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(
+    typename list<T, Allocator>::const_reference value) {
+  emplace_back(value);
+}
 
-  delete node;
-  --size_n;
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
 }
 
-template <typename T>
-void list<T>::push_back(typename list<T>::const_reference value) {
-  Node* newNode = new Node(value);
-  if (tail) {
-    tail->next = newNode;
-    newNode->prev = tail;
-    tail = newNode;
-  } else {
-    head = tail = newNode;
-  }
-  ++size_n;
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_back(
+    Args&&... args) {
+  return *emplace(cend(), std::forward<Args>(args)...);
 }
 
-template <typename T>
-void list<T>::pop_back() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_back() {
   if (empty()) {
     throw std::out_of_range("List is empty");
   }
-  Node* oldTail = tail;
-  tail = tail->prev;
-  if (tail) {
-    tail->next = nullptr;
-  } else {
-    head = nullptr;
-  }
-  delete oldTail;
-  --size_n;
+  erase(iterator(end_node->prev));
 }
 
-template <typename T>
-void list<T>::push_front(typename list<T>::const_reference value) {
-  Node* newNode = new Node(value);
-  if (head) {
-    head->prev = newNode;
-    newNode->next = head;
-    head = newNode;
-  } else {
-    head = tail = newNode;
-  }
-  ++size_n;
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(
+    typename list<T, Allocator>::const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
 }
 
-template <typename T>
-void list<T>::pop_front() {
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_front(
+    Args&&... args) {
+  return *emplace(cbegin(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_front() {
   if (empty()) {
     throw std::out_of_range("List is empty");
   }
-  Node* oldHead = head;
-  head = head->next;
-  if (head) {
-    head->prev = nullptr;
-  } else {
-    tail = nullptr;
-  }
-  delete oldHead;
-  --size_n;
+  erase(begin());
 }
 
-template <typename T>
-void list<T>::swap(list& other) {
-  std::swap(head, other.head);
-  std::swap(tail, other.tail);
+// Меняются сторожа и пулы, поэтому итераторы на элементы остаются валидными
+template <typename T, typename Allocator>
+void list<T, Allocator>::swap(list& other) noexcept {
+  pool_.swap(other.pool_);
   std::swap(end_node, other.end_node);
   std::swap(size_n, other.size_n);
 }
 
-template <typename T>
-void list<T>::merge(list& other) {
-  if (this != &other) {
-    if (empty()) {
-      swap(other);
-    } else if (!other.empty()) {
-      sort();
-      other.sort();
-
-      Node* mergedHead = nullptr;
-      Node* mergedTail = nullptr;
-
-      Node* current1 = head;
-      Node* current2 = other.head;
-
-      while (current1 && current2) {
-        if (current1->data <= current2->data) {
-          if (!mergedHead) {
-            mergedHead = current1;
-            mergedTail = current1;
-          } else {
-            mergedTail->next = current1;
-            current1->prev = mergedTail;
-            mergedTail = current1;
-          }
-          current1 = current1->next;
-        } else {
-          if (!mergedHead) {
-            mergedHead = current2;
-            mergedTail = current2;
-          } else {
-            mergedTail->next = current2;
-            current2->prev = mergedTail;
-            mergedTail = current2;
-          }
-          current2 = current2->next;
-        }
-      }
-
-      Node* remaining = current1 ? current1 : current2;
-      while (remaining) {
-        mergedTail->next = remaining;
-        remaining->prev = mergedTail;
-        mergedTail = remaining;
-        remaining = remaining->next;
-      }
-
-      head = mergedHead;
-      tail = mergedTail;
-      size_n += other.size_n;
-
-      other.head = other.tail = nullptr;
-      other.size_n = 0;
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge(list& other) {
+  merge(other, std::less<>());
+}
+
+// Оба списка должны быть упорядочены по comp. Узлы other перевешиваются
+// вместе с плитами его пула, при равенстве первыми идут элементы *this.
+// Аллокаторы списков должны быть равны, как и в std::list.
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::merge(list& other, Compare comp) {
+  if (this != &other && !other.empty()) {
+    size_type total = size_n + other.size_n;
+    Node* chain = merge_chains(detach_chain(), other.detach_chain(), comp);
+    other.set_size(0);
+    pool_.absorb(other.pool_);
+    relink(chain);
+    set_size(total);
+  }
+}
+
+// Узлы other переносятся перед pos без копирования, плиты его пула
+// переходят к этому списку
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(const iterator pos, list& other) {
+  if (this != &other && !other.empty()) {
+    Node* node = pos.getNode();
+    Node* first = other.end_node->next;
+    Node* last = other.end_node->prev;
+    other.end_node->next = other.end_node->prev = other.end_node;
+    first->prev = node->prev;
+    node->prev->next = first;
+    last->next = node;
+    node->prev = last;
+    set_size(size_n + other.size_n);
+    other.set_size(0);
+    pool_.absorb(other.pool_);
+  }
+}
+
+// Меняет местами next и prev у всех узлов, включая сторожа
+template <typename T, typename Allocator>
+void list<T, Allocator>::reverse() {
+  Node* node = end_node;
+  do {
+    std::swap(node->next, node->prev);
+    node = node->prev;
+  } while (node != end_node);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::unique() {
+  Node* node = end_node->next;
+  while (node != end_node && node->next != end_node) {
+    Node* next = node->next;
+    if (node->data == next->data) {
+      unlink(next);
+      destroy_node(next);
+    } else {
+      node = next;
     }
   }
 }
 
-template <typename T>
-void list<T>::splice(const iterator pos, list& other) {
-  Node* node = pos.getNode();
-
-  if (this != &other) {
-    if (!node || node == end_node) {
-      if (!empty()) {
-        tail->next = other.head;
-        if (other.head) {
-          other.head->prev = tail;
-        }
-        tail = other.tail;
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort() {
+  sort(std::less<>());
+}
+
+// Восходящая сортировка слиянием: проходы сливают соседние отрезки длины
+// 1, 2, 4, ... по указателям next. Узлы только перевешиваются, значения
+// не копируются, память не выделяется; сортировка устойчива.
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::sort(Compare comp) {
+  if (size_n < 2) return;
+  Node* chain = detach_chain();
+  for (size_type width = 1; width < size_n; width *= 2) {
+    Node* sorted = nullptr;
+    Node* sorted_tail = nullptr;
+    Node* rest = chain;
+    while (rest) {
+      Node* left = rest;
+      Node* right = cut(left, width);
+      rest = cut(right, width);
+      Node* merged = merge_chains(left, right, comp);
+      if (sorted_tail) {
+        sorted_tail->next = merged;
       } else {
-        head = other.head;
-        tail = other.tail;
+        sorted = merged;
       }
-      size_n += other.size_n;
-      other.head = other.tail = nullptr;
-      other.size_n = 0;
+      sorted_tail = merged;
+      while (sorted_tail->next) sorted_tail = sorted_tail->next;
+    }
+    chain = sorted;
+  }
+  relink(chain);
+}
+
+// Сливает две упорядоченные цепочки по next; при равенстве берет из first
+template <typename T, typename Allocator>
+template <typename Compare>
+typename list<T, Allocator>::Node* list<T, Allocator>::merge_chains(
+    Node* first, Node* second, Compare& comp) {
+  Node* result = nullptr;
+  Node** link = &result;
+  while (first && second) {
+    if (comp(second->data, first->data)) {
+      *link = second;
+      second = second->next;
     } else {
-      Node* newPrev = node->prev;
-
-      while (!other.empty()) {
-        Node* newNode = new Node(other.front());
-        other.pop_front();
-
-        newNode->next = node;
-        newNode->prev = newPrev;
-
-        if (newPrev) {
-          newPrev->next = newNode;
-        } else {
-          head = newNode;
-        }
-
-        node->prev = newNode;
-        newPrev = newNode;
-
-        ++size_n;
-      }
+      *link = first;
+      first = first->next;
     }
+    link = &(*link)->next;
   }
+  *link = first ? first : second;
+  return result;
 }
 
-template <typename T>
-void list<T>::reverse() {
-  Node* current = head;
-  Node* temp = nullptr;
-
-  while (current) {
-    temp = current->prev;
-    current->prev = current->next;
-    current->next = temp;
-    current = current->prev;
-  }
-
-  if (temp) {
-    temp = temp->prev;
-    std::swap(head, tail);
-  }
+// Отрезает от цепочки первые count узлов и возвращает остаток
+template <typename T, typename Allocator>
+typename list<T, Allocator>::Node* list<T, Allocator>::cut(Node* chain,
+                                                         size_type count) {
+  for (size_type i = 1; chain && i < count; ++i) chain = chain->next;
+  if (!chain) return nullptr;
+  Node* rest = chain->next;
+  chain->next = nullptr;
+  return rest;
 }
 
-template <typename T>
-void list<T>::unique() {
-  if (!empty()) {
-    iterator it = begin();
-    iterator next = it;
-    ++next;
-
-    while (next != end()) {
-      if (*it == *next) {
-        erase(next);
-        next = it;
-        ++next;
-      } else {
-        ++it;
-        ++next;
-      }
-    }
-  }
-}
-
-template <typename T>
-void list<T>::sort() {
-  if (size_n > 2) {
-    for (iterator i = begin(); i != end(); ++i) {
-      for (iterator j = begin(); j != end(); ++j) {
-        iterator next = j;
-        ++next;
-
-        if (next != end() && *j > *next) {
-          std::swap(*j, *next);
-        }
-      }
-    }
+// Замыкает цепочку по next в кольцо со сторожем и восстанавливает prev
+template <typename T, typename Allocator>
+void list<T, Allocator>::relink(Node* chain) {
+  Node* prev = end_node;
+  for (Node* node = chain; node; node = node->next) {
+    node->prev = prev;
+    prev->next = node;
+    prev = node;
   }
+  prev->next = end_node;
+  end_node->prev = prev;
 }
 
 // Реализация insert_many
 
-template <typename T>
+// Вставляет элементы по порядку перед pos и возвращает последний из них
+template <typename T, typename Allocator>
 template <typename... Args>
-typename list<T>::iterator list<T>::insert_many(const_iterator pos,
-                                                Args&&... args) {
-  iterator it(const_cast<Node*>(pos.getNode()), end_node);
-  for (const auto& arg : {args...}) {
-    it = insert(it, arg);
-  }
-  return it;
+typename list<T, Allocator>::iterator list<T, Allocator>::insert_many(
+    const_iterator pos, Args&&... args) {
+  iterator last(const_cast<Node*>(pos.getNode()));
+  ((last = emplace(pos, std::forward<Args>(args))), ...);
+  return last;
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_back(Args&&... args) {
-  insert_many(cend(), args...);
+void list<T, Allocator>::insert_many_back(Args&&... args) {
+  insert_many(cend(), std::forward<Args>(args)...);
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_front(Args&&... args) {
-  insert_many(cbegin(), args...);
+void list<T, Allocator>::insert_many_front(Args&&... args) {
+  insert_many(cbegin(), std::forward<Args>(args)...);
 }
 
 }  // namespace s21
 
-#endif  // S21_LIST_H
\ No newline at end of file
+#endif  // S21_LIST_H
@@ -5,6 +5,9 @@
 #include <iostream>
 #include <iterator>
 #include <list>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "../s21_containersplus.h"
 #include "../tests.cpp"
@@ -99,4 +102,238 @@ TEST(list_constructor_suit, move_operator_constructor) {
     ++s21it;
     ++stdit;
   }
-}
\ No newline at end of file
+}
+
+template <typename T>
+std::vector<T> list_values(const s21::list<T>& l) {
+  return std::vector<T>(l.cbegin(), l.cend());
+}
+
+TEST(list_sort_suit, sort_and_comparator) {
+  s21::list<int> two{2, 1};
+  two.sort();
+  EXPECT_EQ(list_values(two), (std::vector<int>{1, 2}));
+  s21::list<int> s21list{5, 3, 9, 1, 3, 7, 0};
+  s21list.sort();
+  EXPECT_EQ(list_values(s21list), (std::vector<int>{0, 1, 3, 3, 5, 7, 9}));
+  EXPECT_EQ(s21list.front(), 0);
+  EXPECT_EQ(s21list.back(), 9);
+  s21list.sort(std::greater<int>());
+  EXPECT_EQ(list_values(s21list), (std::vector<int>{9, 7, 5, 3, 3, 1, 0}));
+  s21list.pop_back();
+  EXPECT_EQ(s21list.back(), 1);
+}
+
+TEST(list_sort_suit, sort_is_stable_and_fast) {
+  s21::list<std::pair<int, int>> pairs;
+  std::vector<std::pair<int, int>> expected;
+  for (int i = 0; i < 200000; ++i) {
+    std::pair<int, int> item((i * 7919) % 1000, i);
+    pairs.push_back(item);
+    expected.push_back(item);
+  }
+  auto by_key = [](const auto& a, const auto& b) { return a.first < b.first; };
+  pairs.sort(by_key);
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+  EXPECT_EQ(list_values(pairs), expected);
+}
+
+TEST(list_sort_suit, merge_sorted) {
+  s21::list<std::pair<int, char>> a{{1, 'a'}, {3, 'a'}, {5, 'a'}};
+  s21::list<std::pair<int, char>> b{{1, 'b'}, {2, 'b'}, {6, 'b'}};
+  a.merge(b, [](const auto& x, const auto& y) { return x.first < y.first; });
+  EXPECT_TRUE(b.empty());
+  std::vector<std::pair<int, char>> expected{{1, 'a'}, {1, 'b'}, {2, 'b'},
+                                             {3, 'a'}, {5, 'a'}, {6, 'b'}};
+  EXPECT_EQ(list_values(a), expected);
+  EXPECT_EQ(a.back().second, 'b');
+  s21::list<int> c;
+  s21::list<int> d{1, 2};
+  c.merge(d);
+  EXPECT_EQ(list_values(c), (std::vector<int>{1, 2}));
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(list_sentinel_suit, reverse_traversal_from_end) {
+  s21::list<int> s21list{1, 2, 3, 4};
+  s21::list<int>::iterator it = s21list.end();
+  --it;
+  EXPECT_EQ(*it, 4);
+  EXPECT_EQ(*std::prev(s21list.end(), 4), 1);
+  EXPECT_EQ(std::vector<int>(s21list.rbegin(), s21list.rend()),
+            (std::vector<int>{4, 3, 2, 1}));
+  EXPECT_EQ(std::vector<int>(s21list.crbegin(), s21list.crend()),
+            (std::vector<int>{4, 3, 2, 1}));
+  EXPECT_EQ(sizeof(s21::list<int>::iterator), sizeof(void*));
+  s21list.reverse();
+  EXPECT_EQ(list_values(s21list), (std::vector<int>{4, 3, 2, 1}));
+  EXPECT_EQ(*--s21list.end(), 1);
+}
+
+TEST(list_sentinel_suit, insert_erase_splice) {
+  s21::list<std::string> s21list{"b", "d"};
+  auto it = s21list.insert(s21list.begin(), "a");
+  EXPECT_EQ(*it, "a");
+  s21list.insert(s21list.end(), "e");
+  s21list.insert(std::prev(s21list.end(), 2), "c");
+  EXPECT_EQ(list_values(s21list),
+            (std::vector<std::string>{"a", "b", "c", "d", "e"}));
+  s21list.erase(std::next(s21list.begin()));
+  EXPECT_THROW(s21list.erase(s21list.end()), std::out_of_range);
+  s21::list<std::string> other{"x", "y"};
+  auto pos = std::next(s21list.begin());
+  s21list.splice(pos, other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(list_values(s21list),
+            (std::vector<std::string>{"a", "x", "y", "c", "d", "e"}));
+  EXPECT_EQ(*pos, "c");
+  EXPECT_EQ(s21list.size(), 6u);
+}
+
+TEST(list_sentinel_suit, insert_many) {
+  s21::list<int> s21list{1, 5};
+  auto it = s21list.insert_many(std::next(s21list.cbegin()), 2, 3, 4);
+  EXPECT_EQ(*it, 4);
+  s21list.insert_many_back(6, 7);
+  s21list.insert_many_front(-1, 0);
+  EXPECT_EQ(list_values(s21list),
+            (std::vector<int>{-1, 0, 1, 2, 3, 4, 5, 6, 7}));
+  EXPECT_EQ(*s21list.end(), 9);
+  s21list.clear();
+  EXPECT_TRUE(s21list.empty());
+  EXPECT_EQ(s21list.begin(), s21list.end());
+}
+
+// аллокатор, считающий запросы блоков у пула списка
+static size_t list_slab_allocations = 0;
+
+template <typename T>
+struct SlabCountingAllocator {
+  using value_type = T;
+  SlabCountingAllocator() = default;
+  template <typename U>
+  SlabCountingAllocator(const SlabCountingAllocator<U>&) {}
+  T* allocate(size_t n) {
+    ++list_slab_allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) { std::allocator<T>().deallocate(p, n); }
+  template <typename U>
+  bool operator==(const SlabCountingAllocator<U>&) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const SlabCountingAllocator<U>&) const {
+    return false;
+  }
+};
+
+TEST(list_pool_suit, nodes_come_from_slabs) {
+  list_slab_allocations = 0;
+  s21::list<int, SlabCountingAllocator<int>> a;
+  for (int i = 0; i < 10000; ++i) a.push_back(i);
+  EXPECT_LT(list_slab_allocations, 50u);  // а не 10000 узлов по одному
+  size_t before = list_slab_allocations;
+  for (int round = 0; round < 1000; ++round) {
+    a.pop_front();
+    a.push_back(round);
+  }
+  EXPECT_EQ(list_slab_allocations, before);
+  const int* last = &a.back();
+  a.pop_back();
+  a.push_back(42);
+  EXPECT_EQ(&a.back(), last);
+
+  s21::list<int, SlabCountingAllocator<int>> b{1, 2, 3};
+  a.splice(a.begin(), b);
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.size(), 10003u);
+  b.push_back(7);
+  s21::list<int, SlabCountingAllocator<int>> c(std::move(b));
+  a.merge(c);
+  EXPECT_EQ(a.size(), 10004u);
+}
+
+// перенос конструктором выделяет сторожа для источника и может бросить
+static_assert(!std::is_nothrow_move_constructible_v<s21::list<int>>);
+static_assert(std::is_nothrow_move_assignable_v<s21::list<int>>);
+
+TEST(list_pool_suit, emplace_and_move_only) {
+  s21::list<std::unique_ptr<int>> s21list;
+  s21list.push_back(std::make_unique<int>(2));
+  s21list.emplace_front(new int(1));
+  auto& back = s21list.emplace_back(new int(4));
+  s21list.emplace(std::prev(s21list.cend()), new int(3));
+  EXPECT_EQ(*back, 4);
+  int expected = 1;
+  for (const auto& item : s21list) EXPECT_EQ(*item, expected++);
+  s21::list<std::string> words;
+  words.emplace_back(3, 'a');
+  std::string moved = "moved";
+  words.push_front(std::move(moved));
+  EXPECT_EQ(list_values(words), (std::vector<std::string>{"moved", "aaa"}));
+}
+
+struct LruTag {};
+struct RunTag {};
+
+struct Job : s21::intrusive_list_hook<LruTag>,
+             s21::intrusive_list_hook<RunTag> {
+  explicit Job(int id) : id(id) {}
+  int id;
+};
+
+template <typename Tag>
+std::vector<int> job_ids(const s21::intrusive_list<Job, Tag>& l) {
+  std::vector<int> ids;
+  for (const Job& job : l) ids.push_back(job.id);
+  return ids;
+}
+
+TEST(intrusive_list_suit, lru_and_run_queue) {
+  std::vector<Job> jobs;
+  for (int i = 0; i < 4; ++i) jobs.emplace_back(i);
+  s21::intrusive_list<Job, LruTag> lru;
+  s21::intrusive_list<Job, RunTag> run;
+  for (Job& job : jobs) {
+    lru.push_front(job);
+    run.push_back(job);
+  }
+  EXPECT_EQ(job_ids(lru), (std::vector<int>{3, 2, 1, 0}));
+  lru.splice(lru.cbegin(), lru, lru.iterator_to(jobs[1]));
+  EXPECT_EQ(job_ids(lru), (std::vector<int>{1, 3, 2, 0}));
+  EXPECT_EQ(lru.back().id, 0);
+  lru.pop_back();
+  EXPECT_FALSE(jobs[0].intrusive_list_hook<LruTag>::is_linked());
+  EXPECT_TRUE(jobs[0].intrusive_list_hook<RunTag>::is_linked());
+  auto next = run.erase(run.iterator_to(jobs[1]));
+  EXPECT_EQ(next->id, 2);
+  EXPECT_EQ(job_ids(run), (std::vector<int>{0, 2, 3}));
+  EXPECT_THROW(run.push_back(jobs[2]), std::invalid_argument);
+  EXPECT_THROW(run.erase(run.cend()), std::out_of_range);
+  EXPECT_EQ(lru.size(), 3u);
+  EXPECT_EQ(run.size(), 3u);
+}
+
+TEST(intrusive_list_suit, move_swap_clear) {
+  Job a(1), b(2), c(3);
+  s21::intrusive_list<Job, RunTag> first;
+  first.push_back(a);
+  first.push_back(b);
+  s21::intrusive_list<Job, RunTag> second(std::move(first));
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(job_ids(second), (std::vector<int>{1, 2}));
+  first.push_back(c);
+  first.swap(second);
+  EXPECT_EQ(job_ids(first), (std::vector<int>{1, 2}));
+  EXPECT_EQ(job_ids(second), (std::vector<int>{3}));
+  EXPECT_EQ((--first.end())->id, 2);
+  first.splice(first.cbegin(), second);
+  EXPECT_EQ(job_ids(first), (std::vector<int>{3, 1, 2}));
+  EXPECT_TRUE(second.empty());
+  Job copy = a;
+  EXPECT_FALSE(copy.intrusive_list_hook<RunTag>::is_linked());
+  first.clear();
+  EXPECT_FALSE(a.intrusive_list_hook<RunTag>::is_linked());
+  EXPECT_TRUE(first.empty());
+}
@@ -0,0 +1,395 @@
+#ifndef S21_LOCKFREE_QUEUE_S21_LOCKFREE_QUEUE_H_
+#define S21_LOCKFREE_QUEUE_S21_LOCKFREE_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Индексы производителя и потребителя разнесены по разным кэш-линиям,
+// чтобы потоки не мешали друг другу ложным разделением
+inline constexpr size_t kCacheLine = 64;
+
+// Емкость ограниченных очередей округляется вверх до степени двойки
+inline size_t lockfree_capacity(size_t capacity) {
+  if (capacity == 0) {
+    throw std::invalid_argument("Queue capacity must be positive");
+  }
+  size_t result = 1;
+  while (result < capacity) result *= 2;
+  return result;
+}
+
+// Ограниченная очередь без блокировок для одного производителя и одного
+// потребителя. Каждая сторона пишет только свой индекс и держит копию
+// чужого, перечитывая его лишь когда копия говорит "полно" или "пусто".
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  explicit spsc_queue(size_type capacity);
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+  ~spsc_queue();
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args);
+  bool try_push(const value_type &value);
+  bool try_push(value_type &&value);
+  bool try_pop(value_type &value);
+  void push(const value_type &value);
+  void push(value_type &&value);
+  void pop(value_type &value);
+
+  template <typename InputIt>
+  size_type push_many(InputIt first, size_type count);
+  template <typename OutputIt>
+  size_type pop_many(OutputIt out, size_type max_count);
+
+  size_type capacity() const;
+  size_type size_approx() const;
+  bool empty() const;
+
+ private:
+  T *buffer_;
+  size_type mask_;
+
+  alignas(kCacheLine) std::atomic<size_type> tail_{0};  // пишет производитель
+  size_type cached_head_ = 0;
+  alignas(kCacheLine) std::atomic<size_type> head_{0};  // пишет потребитель
+  size_type cached_tail_ = 0;
+};
+
+template <typename T>
+inline spsc_queue<T>::spsc_queue(size_type capacity)
+    : mask_(lockfree_capacity(capacity) - 1) {
+  buffer_ = std::allocator<T>().allocate(mask_ + 1);
+}
+
+template <typename T>
+inline spsc_queue<T>::~spsc_queue() {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+    buffer_[i & mask_].~T();
+  }
+  std::allocator<T>().deallocate(buffer_, mask_ + 1);
+}
+
+template <typename T>
+template <typename... Args>
+inline bool spsc_queue<T>::try_emplace(Args &&...args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (tail - cached_head_ > mask_) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    if (tail - cached_head_ > mask_) return false;
+  }
+  ::new (static_cast<void *>(buffer_ + (tail & mask_)))
+      T(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+inline bool spsc_queue<T>::try_push(const value_type &value) {
+  return try_emplace(value);
+}
+
+template <typename T>
+inline bool spsc_queue<T>::try_push(value_type &&value) {
+  return try_emplace(std::move(value));
+}
+
+template <typename T>
+inline bool spsc_queue<T>::try_pop(value_type &value) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (head == cached_tail_) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    if (head == cached_tail_) return false;
+  }
+  T &slot = buffer_[head & mask_];
+  value = std::move(slot);
+  slot.~T();
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+inline void spsc_queue<T>::push(const value_type &value) {
+  while (!try_emplace(value)) std::this_thread::yield();
+}
+
+template <typename T>
+inline void spsc_queue<T>::push(value_type &&value) {
+  while (!try_emplace(std::move(value))) std::this_thread::yield();
+}
+
+template <typename T>
+inline void spsc_queue<T>::pop(value_type &value) {
+  while (!try_pop(value)) std::this_thread::yield();
+}
+
+// Пачка публикуется одной записью индекса; возвращает число помещенных.
+// Если копирование элемента бросит, уже созданные элементы пачки
+// разрушаются и очередь остается прежней
+template <typename T>
+template <typename InputIt>
+inline typename spsc_queue<T>::size_type spsc_queue<T>::push_many(
+    InputIt first, size_type count) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (mask_ + 1 - (tail - cached_head_) < count) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+  }
+  size_type free = mask_ + 1 - (tail - cached_head_);
+  if (count > free) count = free;
+  size_type i = 0;
+  try {
+    for (; i < count; ++i, ++first) {
+      ::new (static_cast<void *>(buffer_ + ((tail + i) & mask_))) T(*first);
+    }
+  } catch (...) {
+    // пачка еще не опубликована, потребитель этих ячеек не видит
+    while (i--) buffer_[(tail + i) & mask_].~T();
+    throw;
+  }
+  if (count) tail_.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+template <typename T>
+template <typename OutputIt>
+inline typename spsc_queue<T>::size_type spsc_queue<T>::pop_many(
+    OutputIt out, size_type max_count) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (cached_tail_ - head < max_count) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+  }
+  size_type count = cached_tail_ - head;
+  if (count > max_count) count = max_count;
+  for (size_type i = 0; i < count; ++i, ++out) {
+    T &slot = buffer_[(head + i) & mask_];
+    *out = std::move(slot);
+    slot.~T();
+  }
+  if (count) head_.store(head + count, std::memory_order_release);
+  return count;
+}
+
+template <typename T>
+inline typename spsc_queue<T>::size_type spsc_queue<T>::capacity() const {
+  return mask_ + 1;
+}
+
+template <typename T>
+inline typename spsc_queue<T>::size_type spsc_queue<T>::size_approx() const {
+  size_type head = head_.load(std::memory_order_acquire);
+  return tail_.load(std::memory_order_acquire) - head;
+}
+
+template <typename T>
+inline bool spsc_queue<T>::empty() const {
+  return size_approx() == 0;
+}
+
+// Ограниченная очередь без блокировок для многих производителей и
+// потребителей. У каждой ячейки свой номер последовательности: он говорит,
+// свободна ли ячейка для записи на данном круге или уже хранит значение,
+// так что потоки соревнуются только за свой индекс через CAS.
+template <typename T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "mpmc_queue requires a nothrow move constructor");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+  ~mpmc_queue();
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args);
+  bool try_push(const value_type &value);
+  bool try_push(value_type &&value);
+  bool try_pop(value_type &value);
+  void push(const value_type &value);
+  void push(value_type &&value);
+  void pop(value_type &value);
+
+  template <typename InputIt>
+  size_type push_many(InputIt first, size_type count);
+  template <typename OutputIt>
+  size_type pop_many(OutputIt out, size_type max_count);
+
+  size_type capacity() const;
+  size_type size_approx() const;
+  bool empty() const;
+
+ private:
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+    T *value() { return reinterpret_cast<T *>(storage); }
+  };
+
+  Cell *claim(std::atomic<size_type> &position, size_type lag);
+
+  Cell *cells_;
+  size_type mask_;
+
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_{0};
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_{0};
+};
+
+template <typename T>
+inline mpmc_queue<T>::mpmc_queue(size_type capacity)
+    : mask_(lockfree_capacity(capacity) - 1) {
+  cells_ = std::allocator<Cell>().allocate(mask_ + 1);
+  for (size_type i = 0; i <= mask_; ++i) {
+    ::new (static_cast<void *>(&cells_[i].sequence))
+        std::atomic<size_type>(i);
+  }
+}
+
+// Вызывается, когда других потоков у очереди уже нет
+template <typename T>
+inline mpmc_queue<T>::~mpmc_queue() {
+  size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+  for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+       pos != tail; ++pos) {
+    cells_[pos & mask_].value()->~T();
+  }
+  std::allocator<Cell>().deallocate(cells_, mask_ + 1);
+}
+
+// Захватывает очередную ячейку для записи (lag = 0) или чтения (lag = 1).
+// Возвращает nullptr, если очередь полна или пуста соответственно.
+// Номер ячейки меняет только захвативший ее поток, публикуя результат.
+template <typename T>
+inline typename mpmc_queue<T>::Cell *mpmc_queue<T>::claim(
+    std::atomic<size_type> &position, size_type lag) {
+  size_type pos = position.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell *cell = &cells_[pos & mask_];
+    size_type sequence = cell->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + lag));
+    if (diff == 0) {
+      if (position.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+        return cell;
+      }
+    } else if (diff < 0) {
+      return nullptr;
+    } else {
+      pos = position.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+// Значение строится до захвата ячейки: исключение не должно оставить
+// захваченную ячейку пустой
+template <typename T>
+template <typename... Args>
+inline bool mpmc_queue<T>::try_emplace(Args &&...args) {
+  return try_push(T(std::forward<Args>(args)...));
+}
+
+template <typename T>
+inline bool mpmc_queue<T>::try_push(const value_type &value) {
+  return try_push(T(value));
+}
+
+// value перемещается только при успехе
+template <typename T>
+inline bool mpmc_queue<T>::try_push(value_type &&value) {
+  Cell *cell = claim(enqueue_pos_, 0);
+  if (!cell) return false;
+  ::new (static_cast<void *>(cell->storage)) T(std::move(value));
+  size_type sequence = cell->sequence.load(std::memory_order_relaxed);
+  cell->sequence.store(sequence + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+inline bool mpmc_queue<T>::try_pop(value_type &value) {
+  Cell *cell = claim(dequeue_pos_, 1);
+  if (!cell) return false;
+  value = std::move(*cell->value());
+  cell->value()->~T();
+  size_type sequence = cell->sequence.load(std::memory_order_relaxed);
+  cell->sequence.store(sequence + mask_, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+inline void mpmc_queue<T>::push(const value_type &value) {
+  push(T(value));
+}
+
+template <typename T>
+inline void mpmc_queue<T>::push(value_type &&value) {
+  while (!try_push(std::move(value))) std::this_thread::yield();
+}
+
+template <typename T>
+inline void mpmc_queue<T>::pop(value_type &value) {
+  while (!try_pop(value)) std::this_thread::yield();
+}
+
+// Элементы пачки могут перемежаться с чужими; возвращает число помещенных
+template <typename T>
+template <typename InputIt>
+inline typename mpmc_queue<T>::size_type mpmc_queue<T>::push_many(
+    InputIt first, size_type count) {
+  size_type pushed = 0;
+  while (pushed < count && try_push(*first)) {
+    ++pushed;
+    ++first;
+  }
+  return pushed;
+}
+
+template <typename T>
+template <typename OutputIt>
+inline typename mpmc_queue<T>::size_type mpmc_queue<T>::pop_many(
+    OutputIt out, size_type max_count) {
+  size_type popped = 0;
+  for (; popped < max_count; ++popped, ++out) {
+    Cell *cell = claim(dequeue_pos_, 1);
+    if (!cell) break;
+    *out = std::move(*cell->value());
+    cell->value()->~T();
+    size_type sequence = cell->sequence.load(std::memory_order_relaxed);
+    cell->sequence.store(sequence + mask_, std::memory_order_release);
+  }
+  return popped;
+}
+
+template <typename T>
+inline typename mpmc_queue<T>::size_type mpmc_queue<T>::capacity() const {
+  return mask_ + 1;
+}
+
+template <typename T>
+inline typename mpmc_queue<T>::size_type mpmc_queue<T>::size_approx() const {
+  size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  return tail > head ? tail - head : 0;
+}
+
+template <typename T>
+inline bool mpmc_queue<T>::empty() const {
+  return size_approx() == 0;
+}
+
+}  // namespace s21
+
+#endif  // S21_LOCKFREE_QUEUE_S21_LOCKFREE_QUEUE_H_
@@ -0,0 +1,140 @@
+#include "s21_lockfree_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../tests.cpp"
+
+TEST(spsc_queue, bounded_fifo) {
+  s21::spsc_queue<std::string> queue(3);
+  EXPECT_EQ(queue.capacity(), 4U);
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.try_push(std::to_string(i)));
+  EXPECT_FALSE(queue.try_push("full"));
+  std::string value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "0");
+  EXPECT_TRUE(queue.try_emplace(2, 'x'));
+  std::vector<std::string> out;
+  EXPECT_EQ(queue.pop_many(std::back_inserter(out), 10), 4U);
+  EXPECT_EQ(out.back(), "xx");
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+  EXPECT_THROW(s21::spsc_queue<int>(0), std::invalid_argument);
+}
+
+TEST(spsc_queue, batch_is_limited_by_space) {
+  s21::spsc_queue<int> queue(8);
+  std::vector<int> items(12);
+  std::iota(items.begin(), items.end(), 0);
+  EXPECT_EQ(queue.push_many(items.begin(), items.size()), 8U);
+  int value = -1;
+  queue.pop(value);
+  EXPECT_EQ(value, 0);
+  EXPECT_EQ(queue.push_many(items.begin() + 8, 4), 1U);
+  EXPECT_EQ(queue.size_approx(), 8U);
+  EXPECT_FALSE(queue.try_push(-1));  // непрочитанное разрушит деструктор
+}
+
+// копирование бросает, когда заканчивается бюджет
+struct BatchItem {
+  static inline int live = 0;
+  static inline int budget = 1 << 30;
+  int value = 0;
+  BatchItem() { ++live; }
+  explicit BatchItem(int v) : value(v) { ++live; }
+  BatchItem(const BatchItem &other) : value(other.value) {
+    if (budget-- == 0) throw std::runtime_error("copy");
+    ++live;
+  }
+  BatchItem &operator=(const BatchItem &) = default;
+  ~BatchItem() { --live; }
+};
+
+TEST(spsc_queue, throwing_batch_leaves_queue_unchanged) {
+  BatchItem::live = 0;
+  {
+    std::vector<BatchItem> items;
+    for (int i = 0; i < 4; ++i) items.emplace_back(i);
+    s21::spsc_queue<BatchItem> queue(8);
+    BatchItem::budget = 2;  // бросает третье копирование пачки
+    EXPECT_THROW(queue.push_many(items.begin(), items.size()),
+                 std::runtime_error);
+    BatchItem::budget = 1 << 30;
+    EXPECT_EQ(BatchItem::live, 4);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.push_many(items.begin(), items.size()), 4U);
+    BatchItem item;
+    queue.pop(item);
+    EXPECT_EQ(item.value, 0);
+  }
+  EXPECT_EQ(BatchItem::live, 0);
+}
+
+TEST(spsc_queue, producer_consumer_order) {
+  const int count = 200000;
+  s21::spsc_queue<int> queue(1024);
+  std::thread producer([&] {
+    for (int i = 0; i < count; i += 4) {
+      int batch[4] = {i, i + 1, i + 2, i + 3};
+      size_t done = 0;
+      while (done < 4) done += queue.push_many(batch + done, 4 - done);
+    }
+  });
+  bool ordered = true;
+  for (int i = 0; i < count; ++i) {
+    int value;
+    queue.pop(value);
+    ordered = ordered && value == i;
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpmc_queue, bounded_fifo) {
+  s21::mpmc_queue<std::string> queue(2);
+  EXPECT_TRUE(queue.try_push("a"));
+  EXPECT_TRUE(queue.try_emplace(1, 'b'));
+  EXPECT_FALSE(queue.try_push("c"));
+  std::string value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "a");
+  std::vector<std::string> items{"c", "d"};
+  EXPECT_EQ(queue.push_many(items.begin(), items.size()), 1U);
+  std::vector<std::string> out;
+  EXPECT_EQ(queue.pop_many(std::back_inserter(out), 5), 2U);
+  EXPECT_EQ(out[1], "c");
+  EXPECT_FALSE(queue.try_pop(value));
+  queue.push("left");
+}
+
+TEST(mpmc_queue, many_producers_and_consumers) {
+  const int threads = 4, per_thread = 50000;
+  s21::mpmc_queue<long> queue(256);
+  std::vector<std::thread> workers;
+  std::vector<long> sums(threads, 0);
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&queue, t] {
+      for (int i = 1; i <= per_thread; ++i) {
+        queue.push(long(t) * per_thread + i);
+      }
+    });
+    workers.emplace_back([&queue, &sums, t] {
+      for (int i = 0; i < per_thread; ++i) {
+        long value;
+        queue.pop(value);
+        sums[t] += value;
+      }
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  long total = std::accumulate(sums.begin(), sums.end(), 0L);
+  long n = long(threads) * per_thread;
+  EXPECT_EQ(total, n * (n + 1) / 2);
+  EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,86 @@
+// Пропускная способность очередей: mutex + s21::queue против spsc_queue и
+// mpmc_queue. Сборка и запуск: make bench
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_queue/s21_queue.h"
+#include "s21_lockfree_queue.h"
+
+namespace {
+
+const long kItems = 4000000;
+const size_t kCapacity = 4096;
+
+// s21::queue под мьютексом с той же емкостью и теми же try-вариантами
+class locked_queue {
+ public:
+  bool try_push(long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() >= kCapacity) return false;
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(long &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<long> queue_;
+};
+
+template <typename Queue>
+double run(Queue &queue, int producers, int consumers) {
+  std::vector<std::thread> threads;
+  auto start = std::chrono::steady_clock::now();
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&queue, producers] {
+      for (long i = 0; i < kItems / producers; ++i) {
+        while (!queue.try_push(i)) std::this_thread::yield();
+      }
+    });
+  }
+  long checksum = 0;
+  std::mutex checksum_mutex;
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&, consumers] {
+      long sum = 0, value;
+      for (long i = 0; i < kItems / consumers; ++i) {
+        while (!queue.try_pop(value)) std::this_thread::yield();
+        sum += value;
+      }
+      std::lock_guard<std::mutex> lock(checksum_mutex);
+      checksum += sum;
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  if (checksum < 0) std::printf("bad checksum\n");
+  return kItems / elapsed.count() / 1e6;
+}
+
+template <typename Queue, typename... Args>
+void report(const char *name, int producers, int consumers, Args... args) {
+  Queue queue(args...);
+  std::printf("%-22s %dP/%dC %8.2f Mops/s\n", name, producers, consumers,
+              run(queue, producers, consumers));
+}
+
+}  // namespace
+
+int main() {
+  report<locked_queue>("mutex + s21::queue", 1, 1);
+  report<s21::spsc_queue<long>>("spsc_queue", 1, 1, kCapacity);
+  report<s21::mpmc_queue<long>>("mpmc_queue", 1, 1, kCapacity);
+  report<locked_queue>("mutex + s21::queue", 4, 4);
+  report<s21::mpmc_queue<long>>("mpmc_queue", 4, 4, kCapacity);
+  return 0;
+}
@@ -4,7 +4,8 @@
 #include "../s21_vector/s21_vector.h"
 
 namespace s21 {
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Compare = std::less<>,
+          typename Allocator = std::allocator<std::pair<const Key, Value>>>
 class map {
  public:
   class Map_Iterator;
@@ -17,17 +18,24 @@ class map {
   using iterator = Map_Iterator;
   using const_iterator = Const_Map_Iterator;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
 
  private:
-  Tree<key_type, value_type> _tree;
+  using tree_type = Tree<key_type, value_type, Compare, Allocator>;
+  tree_type _tree;
+  static const Key& key_of(const value_type& value) { return value.first; }
 
  public:
   map();
+  explicit map(const Compare& comp);
   map(std::initializer_list<value_type> const& items);
+  template <typename ForwardIt>
+  map(ForwardIt first, ForwardIt last);
   // map(std::initializer_list<typename map<Key, Value>::value_type> const&
   // items);
   map(const map& other);
-  map(map&& other);
+  map(map&& other) noexcept;
   ~map();
 
   map& operator=(const map& s);
@@ -42,32 +50,75 @@ class map {
   const_iterator cend() const;
 
   template <typename... Args>
-  vector<std::pair<typename map<Key, Value>::iterator, bool>> insert_many(
-      Args&&... args);
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
   bool empty();
   size_type size();
   size_type max_size();
+  key_compare key_comp() const;
 
   void clear();
 
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  // пара с неконстантным ключом: ключ перемещается, а не копируется
+  template <typename P, typename = std::enable_if_t<
+                            std::is_constructible<value_type, P&&>::value>>
+  std::pair<iterator, bool> insert(P&& value);
   std::pair<iterator, bool> insert(const Key& key, const Value& value);
+  // вставка перед hint: при верной подсказке без спуска от корня
+  iterator insert(iterator hint, const value_type& value);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
   std::pair<iterator, bool> insert_or_assign(const Key& key,
                                              const Value& value);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, Value&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  // значение строится из args, только если ключа ещё нет
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
 
   void erase(iterator pos);
-  void swap(map& other);
+  void swap(map& other) noexcept;
   void merge(map& other);
 
   iterator find(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
   bool contains(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
+
+  iterator nth_element(size_type k);  // k-й по порядку элемент или end()
+  size_type rank(const Key& key);     // число ключей меньше key
+  size_type count_range(const Key& from, const Key& to);  // ключи из [from, to)
+  size_type count(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K& key);
+  iterator lower_bound(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K& key);
+  iterator upper_bound(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K& key);
+  std::pair<iterator, iterator> equal_range(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key);
 
   class Map_Iterator {
    public:
-    using iterator = map<Key, Value>::Map_Iterator;
-    using tree_iterator = typename Tree<Key, value_type>::Iterator;
-    using const_tree_iterator = typename Tree<Key, value_type>::Const_Iterator;
+    using iterator = map<Key, Value, Compare, Allocator>::Map_Iterator;
+    using tree_iterator = typename tree_type::Iterator;
+    using const_tree_iterator = typename tree_type::Const_Iterator;
     Map_Iterator() = default;
     Map_Iterator(tree_iterator it);
     Map_Iterator(const_tree_iterator it);
@@ -104,14 +155,14 @@ class map {
 
     tree_iterator it;
 
-    friend void map<Key, Value>::erase(iterator pos);
+    friend class map<Key, Value, Compare, Allocator>;
   };
 
   class Const_Map_Iterator {
    public:
-    using tree_iterator = typename Tree<Key, value_type>::Iterator;
+    using tree_iterator = typename tree_type::Iterator;
     using const_iterator = Const_Map_Iterator;
-    using const_tree_iterator = typename Tree<Key, value_type>::Const_Iterator;
+    using const_tree_iterator = typename tree_type::Const_Iterator;
     Const_Map_Iterator() = default;
     Const_Map_Iterator(tree_iterator it);
     Const_Map_Iterator(const_tree_iterator it);
@@ -133,35 +184,42 @@ class map {
   };
 };
 
-template <typename Key, typename Value>
-map<Key, Value>::map() : _tree() {}
+template <typename Key, typename Value, typename Compare, typename Allocator>
+map<Key, Value, Compare, Allocator>::map() : _tree() {}
 
-template <typename Key, typename Value>
-map<Key, Value>::map(std::initializer_list<value_type> const& items) {
-  _tree = Tree<Key, value_type>();
-  for (const value_type& item : items) {
-    if (!contains(item.first)) _tree.__insert(item.first, item);
-  }
-}
+template <typename Key, typename Value, typename Compare, typename Allocator>
+map<Key, Value, Compare, Allocator>::map(const Compare& comp) : _tree(comp) {}
 
-template <typename Key, typename Value>
-map<Key, Value>::map(const map& other) {
-  _tree = Tree<Key, value_type>(other._tree);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+map<Key, Value, Compare, Allocator>::map(
+    std::initializer_list<value_type> const& items) {
+  _tree.assign_range(items.begin(), items.end(), key_of, true);
 }
 
-template <typename Key, typename Value>
-map<Key, Value>::map(map&& other) {
-  _tree = std::move(other._tree);
+// диапазон, упорядоченный по ключу без повторов, строится за O(n)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename ForwardIt>
+map<Key, Value, Compare, Allocator>::map(ForwardIt first, ForwardIt last) {
+  _tree.assign_range(first, last, key_of, true);
 }
 
-template <typename Key, typename Value>
-map<Key, Value>::~map() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+map<Key, Value, Compare, Allocator>::map(const map& other)
+    : _tree(other._tree) {}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+map<Key, Value, Compare, Allocator>::map(map&& other) noexcept
+    : _tree(std::move(other._tree)) {}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+map<Key, Value, Compare, Allocator>::~map() {
   // std::cout  <<  "Set destructor!" << std::endl;
   _tree.clean();
 }
 
-template <typename Key, typename Value>
-map<Key, Value>& map<Key, Value>::operator=(const map& s) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+map<Key, Value, Compare, Allocator>&
+map<Key, Value, Compare, Allocator>::operator=(const map& s) {
   if (this == &s) {
     return *this;
   }
@@ -169,8 +227,9 @@ map<Key, Value>& map<Key, Value>::operator=(const map& s) {
   return *this;
 }
 
-template <typename Key, typename Value>
-map<Key, Value>& map<Key, Value>::operator=(map&& s) noexcept {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+map<Key, Value, Compare, Allocator>&
+map<Key, Value, Compare, Allocator>::operator=(map&& s) noexcept {
   if (this == &s) {
     return *this;
   }
@@ -178,186 +237,327 @@ map<Key, Value>& map<Key, Value>::operator=(map&& s) noexcept {
   return *this;
 }
 
-template <typename Key, typename Value>
-inline bool s21::map<Key, Value>::empty() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline bool s21::map<Key, Value, Compare, Allocator>::empty() {
   return _tree.empty();
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::size_type map<Key, Value>::size() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::size_type
+map<Key, Value, Compare, Allocator>::size() {
   return _tree.size();
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::size_type map<Key, Value>::max_size() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::size_type
+map<Key, Value, Compare, Allocator>::max_size() {
   return _tree.max_size();
 }
 
-template <typename Key, typename Value>
-void map<Key, Value>::clear() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::key_compare
+map<Key, Value, Compare, Allocator>::key_comp() const {
+  return _tree.key_comp();
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void map<Key, Value, Compare, Allocator>::clear() {
   _tree.clean();
 }
 
-template <typename Key, typename Value>
-void map<Key, Value>::swap(map& other) {
-  if (this == &other) throw std::invalid_argument("swap");
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void map<Key, Value, Compare, Allocator>::swap(map& other) noexcept {
   _tree.swap(other._tree);
 }
 
-template <typename Key, typename Value>
-void map<Key, Value>::merge(map& other) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void map<Key, Value, Compare, Allocator>::merge(map& other) {
   if (this == &other) throw std::invalid_argument("merge");
   for (auto it = other.begin(); it != other.end(); ++it) {
     if (!contains(it->first)) insert(std::make_pair(it->first, it->second));
   }
 }
 
-template <typename Key, typename Value>
-void map<Key, Value>::erase(iterator pos) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void map<Key, Value, Compare, Allocator>::erase(iterator pos) {
   _tree.erase(pos.it);
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::iterator map<Key, Value>::find(const Key& key) {
-  auto node = _tree.find(key);
-  if (node == nullptr) return end();
-  auto iter = _tree.begin();
-  auto it_end = _tree.end();
-  while (iter != it_end) {
-    if (iter.get_node()->key == key) break;
-    ++iter;
-  }
-  return iterator(iter);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::find(const Key& key) {
+  return iterator(_tree.find_iterator(key));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::find(const K& key) {
+  return iterator(_tree.find_iterator(key));
 }
 
-template <typename Key, typename Value>
-bool map<Key, Value>::contains(const Key& key) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+bool map<Key, Value, Compare, Allocator>::contains(const Key& key) {
   return _tree.contains(key);
 }
 
-template <typename Key, typename Value>
-inline map<Key, Value>::Map_Iterator::Map_Iterator(tree_iterator it) : it(it) {}
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+bool map<Key, Value, Compare, Allocator>::contains(const K& key) {
+  return _tree.contains(key);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::nth_element(size_type k) {
+  return iterator(_tree.nth_element(k));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::size_type
+map<Key, Value, Compare, Allocator>::rank(const Key& key) {
+  return _tree.rank(key);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::size_type
+map<Key, Value, Compare, Allocator>::count_range(const Key& from,
+                                                 const Key& to) {
+  return _tree.count_range(from, to);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::size_type
+map<Key, Value, Compare, Allocator>::count(const Key& key) {
+  return _tree.count(key);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename map<Key, Value, Compare, Allocator>::size_type
+map<Key, Value, Compare, Allocator>::count(const K& key) {
+  return _tree.count(key);
+}
+
+// первый элемент с ключом не меньше key, за O(log n)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::lower_bound(const Key& key) {
+  return iterator(_tree.lower_bound(key));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::lower_bound(const K& key) {
+  return iterator(_tree.lower_bound(key));
+}
+
+// первый элемент с ключом больше key, за O(log n)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::upper_bound(const Key& key) {
+  return iterator(_tree.upper_bound(key));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::upper_bound(const K& key) {
+  return iterator(_tree.upper_bound(key));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+std::pair<typename map<Key, Value, Compare, Allocator>::iterator,
+          typename map<Key, Value, Compare, Allocator>::iterator>
+map<Key, Value, Compare, Allocator>::equal_range(const Key& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+std::pair<typename map<Key, Value, Compare, Allocator>::iterator,
+          typename map<Key, Value, Compare, Allocator>::iterator>
+map<Key, Value, Compare, Allocator>::equal_range(const K& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline map<Key, Value, Compare, Allocator>::Map_Iterator::Map_Iterator(
+    tree_iterator it)
+    : it(it) {}
 
 //
 //
 //
 //
 
-template <typename Key, typename Value>
-inline map<Key, Value>::Map_Iterator::Map_Iterator(const_tree_iterator it)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline map<Key, Value, Compare, Allocator>::Map_Iterator::Map_Iterator(
+    const_tree_iterator it)
     : it(it) {}
 
-template <typename Key, typename Value>
-typename map<Key, Value>::Map_Iterator&
-map<Key, Value>::Map_Iterator::operator++() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::Map_Iterator&
+map<Key, Value, Compare, Allocator>::Map_Iterator::operator++() {
   ++it;
   return *this;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::Map_Iterator&
-map<Key, Value>::Map_Iterator::operator--() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::Map_Iterator&
+map<Key, Value, Compare, Allocator>::Map_Iterator::operator--() {
   --it;
   return *this;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::Map_Iterator
-map<Key, Value>::Map_Iterator::operator++(int) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::Map_Iterator
+map<Key, Value, Compare, Allocator>::Map_Iterator::operator++(int) {
   return it++;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::Map_Iterator
-map<Key, Value>::Map_Iterator::operator--(int) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::Map_Iterator
+map<Key, Value, Compare, Allocator>::Map_Iterator::operator--(int) {
   return it--;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::Map_Iterator&
-map<Key, Value>::Map_Iterator::operator=(const Map_Iterator& other) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::Map_Iterator&
+map<Key, Value, Compare, Allocator>::Map_Iterator::operator=(
+    const Map_Iterator& other) {
   if (this != &other) {
     it = other.it;
   }
   return *this;
 }
 
-template <typename Key, typename Value>
-bool map<Key, Value>::Map_Iterator::operator==(const iterator& other) const {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+bool map<Key, Value, Compare, Allocator>::Map_Iterator::operator==(
+    const iterator& other) const {
   return it == other.it;
 }
 
-template <typename Key, typename Value>
-inline bool map<Key, Value>::Map_Iterator::operator!=(
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline bool map<Key, Value, Compare, Allocator>::Map_Iterator::operator!=(
     const iterator& other) const {
   return it != other.it;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::const_reference
-map<Key, Value>::Map_Iterator::operator*() const {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::const_reference
+map<Key, Value, Compare, Allocator>::Map_Iterator::operator*() const {
   if (it.get_node() == nullptr)
     throw std::out_of_range("Map_Iterator::operator*()");
   return *it;
 }
 
-template <typename Key, typename Value>
-const typename map<Key, Value>::value_type*
-map<Key, Value>::Map_Iterator::operator->() const {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+const typename map<Key, Value, Compare, Allocator>::value_type*
+map<Key, Value, Compare, Allocator>::Map_Iterator::operator->() const {
   if (it.get_node() == nullptr)
     throw std::out_of_range("Map_Iterator::operator*()");
   return &(*it);
 }
 
-template <typename Key, typename Value>
-typename std::pair<typename map<Key, Value>::iterator, bool>
-map<Key, Value>::insert(const value_type& value) {
-  return insert(value.first, value.second);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>
+map<Key, Value, Compare, Allocator>::insert(const value_type& value) {
+  auto res = _tree.insert(value.first, value);
+  return std::make_pair(iterator(res.first), res.second);
 }
 
-template <typename Key, typename Value>
-typename std::pair<typename map<Key, Value>::iterator, bool>
-map<Key, Value>::insert(const Key& key, const Value& value) {
-  if (contains(key)) {
-    auto it = find(key);
-    return std::make_pair(it, false);
-  }
-  auto res = _tree.insert(key, std::make_pair(key, value));
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>
+map<Key, Value, Compare, Allocator>::insert(value_type&& value) {
+  auto res = _tree.emplace_unique(std::move(value));
   return std::make_pair(iterator(res.first), res.second);
 }
 
-template <typename Key, typename Value>
-typename std::pair<typename map<Key, Value>::iterator, bool>
-map<Key, Value>::insert_or_assign(const Key& key, const Value& value) {
-  if (contains(key)) {
-    auto it = find(key);
-    erase(it);
-    insert(key, value);
-    it = find(key);
-    // auto pair = insert_or_assign(key, value);
-    return std::make_pair(it, true);
-  }
-  auto res = _tree.insert(key, std::make_pair(key, value));
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename P, typename>
+typename std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>
+map<Key, Value, Compare, Allocator>::insert(P&& value) {
+  return emplace(std::forward<P>(value));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>
+map<Key, Value, Compare, Allocator>::insert(const Key& key,
+                                            const Value& value) {
+  return try_emplace(key, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>
+map<Key, Value, Compare, Allocator>::insert_or_assign(const Key& key,
+                                                      const Value& value) {
+  auto res = _tree.try_emplace(key, key, value);
+  if (!res.second) res.first->second = value;
+  return std::make_pair(iterator(res.first), true);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>
+map<Key, Value, Compare, Allocator>::insert_or_assign(const Key& key,
+                                                      Value&& value) {
+  auto res = _tree.try_emplace(key, key, std::move(value));
+  if (!res.second) res.first->second = std::move(value);
+  return std::make_pair(iterator(res.first), true);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+typename std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>
+map<Key, Value, Compare, Allocator>::emplace(Args&&... args) {
+  auto res = _tree.emplace_unique(std::forward<Args>(args)...);
+  return std::make_pair(iterator(res.first), res.second);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+typename std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>
+map<Key, Value, Compare, Allocator>::try_emplace(const Key& key,
+                                                 Args&&... args) {
+  auto res = _tree.try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  return std::make_pair(iterator(res.first), res.second);
+}
+
+// ключ перемещается в узел, только если вставка состоялась
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+typename std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>
+map<Key, Value, Compare, Allocator>::try_emplace(Key&& key, Args&&... args) {
+  auto res = _tree.try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
   return std::make_pair(iterator(res.first), res.second);
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::iterator map<Key, Value>::begin() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::begin() {
   return iterator(_tree.begin());
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::iterator map<Key, Value>::end() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::end() {
   return iterator(_tree.end());
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::const_iterator map<Key, Value>::cbegin() const {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::const_iterator
+map<Key, Value, Compare, Allocator>::cbegin() const {
   return const_iterator(_tree.cbegin());
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::const_iterator map<Key, Value>::cend() const {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::const_iterator
+map<Key, Value, Compare, Allocator>::cend() const {
   return const_iterator(_tree.cend());
 }
 
@@ -367,72 +567,73 @@ typename map<Key, Value>::const_iterator map<Key, Value>::cend() const {
 //
 //
 
-template <typename Key, typename Value>
-inline map<Key, Value>::Const_Map_Iterator::Const_Map_Iterator(tree_iterator it)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline map<Key, Value, Compare, Allocator>::Const_Map_Iterator::
+    Const_Map_Iterator(tree_iterator it)
     : it(it) {}
 
-template <typename Key, typename Value>
-inline map<Key, Value>::Const_Map_Iterator::Const_Map_Iterator(
-    const_tree_iterator it)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline map<Key, Value, Compare, Allocator>::Const_Map_Iterator::
+    Const_Map_Iterator(const_tree_iterator it)
     : it(it){};
 
-template <typename Key, typename Value>
-typename map<Key, Value>::Const_Map_Iterator&
-map<Key, Value>::Const_Map_Iterator::operator++() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::Const_Map_Iterator&
+map<Key, Value, Compare, Allocator>::Const_Map_Iterator::operator++() {
   ++it;
   return *this;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::Const_Map_Iterator&
-map<Key, Value>::Const_Map_Iterator::operator--() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::Const_Map_Iterator&
+map<Key, Value, Compare, Allocator>::Const_Map_Iterator::operator--() {
   --it;
   return *this;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::Const_Map_Iterator
-map<Key, Value>::Const_Map_Iterator::operator++(int) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::Const_Map_Iterator
+map<Key, Value, Compare, Allocator>::Const_Map_Iterator::operator++(int) {
   return it++;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::Const_Map_Iterator
-map<Key, Value>::Const_Map_Iterator::operator--(int) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::Const_Map_Iterator
+map<Key, Value, Compare, Allocator>::Const_Map_Iterator::operator--(int) {
   return it--;
 }
 
-template <typename Key, typename Value>
-bool map<Key, Value>::Const_Map_Iterator::operator==(
+template <typename Key, typename Value, typename Compare, typename Allocator>
+bool map<Key, Value, Compare, Allocator>::Const_Map_Iterator::operator==(
     const const_iterator& other) const {
   return it == other.it;
 }
 
-template <typename Key, typename Value>
-inline bool map<Key, Value>::Const_Map_Iterator::operator!=(
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline bool map<Key, Value, Compare, Allocator>::Const_Map_Iterator::operator!=(
     const const_iterator& other) const {
   return it != other.it;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::const_reference
-map<Key, Value>::Const_Map_Iterator::operator*() const {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::const_reference
+map<Key, Value, Compare, Allocator>::Const_Map_Iterator::operator*() const {
   if (it.get_node() == nullptr)
     throw std::out_of_range("Const_Map_Iterator::operator*()");
   return *it;
 }
 
-template <typename Key, typename Value>
-typename map<Key, Value>::value_type*
-map<Key, Value>::Const_Map_Iterator::operator->() const {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::value_type*
+map<Key, Value, Compare, Allocator>::Const_Map_Iterator::operator->() const {
   return &(it->value);
 }
 
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Compare, typename Allocator>
 template <typename... Args>
-vector<std::pair<typename map<Key, Value>::iterator, bool>>
-map<Key, Value>::insert_many(Args&&... args) {
-  vector<std::pair<typename map<Key, Value>::iterator, bool>> result_vector;
+vector<std::pair<typename map<Key, Value, Compare, Allocator>::iterator, bool>>
+map<Key, Value, Compare, Allocator>::insert_many(Args&&... args) {
+  vector<std::pair<iterator, bool>> result_vector;
   result_vector.reserve(sizeof...(args));
 
   auto args_tuple = std::make_tuple(std::forward<Args>(args)...);
@@ -450,21 +651,37 @@ map<Key, Value>::insert_many(Args&&... args) {
   return result_vector;
 }
 
-template <typename Key, typename Value>
-inline Value& map<Key, Value>::operator[](
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline Value& map<Key, Value, Compare, Allocator>::operator[](
     const Key& key) {  // TODO Rebuild. Or not..?
   return _tree.at(key).second;
 }
 
-template <typename Key, typename Value>
-inline Value& map<Key, Value>::at(const Key& key) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline Value& map<Key, Value, Compare, Allocator>::at(const Key& key) {
   return _tree.at(key).second;
 }
 
-template <typename Key, typename Value>
-inline typename map<Key, Value>::Map_Iterator::tree_iterator
-map<Key, Value>::Map_Iterator::get_it() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline typename map<Key, Value, Compare, Allocator>::Map_Iterator::tree_iterator
+map<Key, Value, Compare, Allocator>::Map_Iterator::get_it() {
   return it;
 }
 
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::insert(iterator hint,
+                                            const value_type& value) {
+  return emplace_hint(hint, value);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+typename map<Key, Value, Compare, Allocator>::iterator
+map<Key, Value, Compare, Allocator>::emplace_hint(iterator hint,
+                                                  Args&&... args) {
+  auto res = _tree.emplace_hint_unique(hint.it, std::forward<Args>(args)...);
+  return iterator(res.first);
+}
+
 }  // namespace s21
\ No newline at end of file
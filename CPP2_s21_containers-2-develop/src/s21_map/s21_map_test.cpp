@@ -1,6 +1,10 @@
 // #include <gtest/gtest.h>
 #include "../s21_map/s21_map.hpp"
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "../tests.cpp"
 using namespace s21;
 
@@ -127,6 +131,23 @@ TEST(map_iterator_operator, decrement_test_1) {
   }
 }
 
+TEST(map_iterator, parent_links) {
+  using tree_iterator = s21::Tree<int, std::pair<const int, int>>::Iterator;
+  EXPECT_TRUE(std::is_trivially_copyable<tree_iterator>::value);
+  s21::map<int, int> _map;
+  auto first = _map.insert(50, 0).first;
+  for (int i = 0; i < 100; ++i) _map.insert(i, i);
+  EXPECT_EQ(first->first, 50);
+  EXPECT_EQ((++first)->first, 51);  // итератор жив после поворотов
+  auto i = _map.end();
+  EXPECT_EQ((--i)->first, 99);
+  EXPECT_TRUE(++i == _map.end());
+  _map.erase(_map.find(99));
+  EXPECT_EQ((--i)->first, 98);
+  auto j = _map.begin();
+  EXPECT_TRUE(--j == _map.end());
+}
+
 TEST(map_insert, insert_test_0) {
   s21::map<int, int> _map;
   _map.insert(0, 9);
@@ -156,6 +177,28 @@ TEST(map_insert, insert_or_assign_test_0) {
   EXPECT_EQ(_map[5], 9);
 }
 
+TEST(map_insert, insert_large) {
+  s21::map<int, int> _map;
+  const int n = 100003;
+  for (int i = 0; i < n; ++i) {
+    int key = static_cast<int>((i * 7919LL) % n);
+    auto res = _map.insert(key, -key);
+    ASSERT_TRUE(res.second);
+    ASSERT_EQ(res.first->first, key);
+  }
+  EXPECT_EQ(_map.insert(5, 0).first->second, -5);
+  EXPECT_EQ(_map.insert_or_assign(5, 0).first->second, 0);
+  auto it = _map.find(500);
+  EXPECT_EQ((++it)->first, 501);
+  EXPECT_EQ((--(--it))->first, 499);
+  EXPECT_TRUE(_map.find(n) == _map.end());
+  int expected = 0;
+  for (auto i = _map.begin(); i != _map.end(); ++i) {
+    EXPECT_EQ(i->first, expected++);
+  }
+  EXPECT_EQ(expected, n);
+}
+
 TEST(map_erase, erase_test_0) {
   s21::map<int, int> _map(
       {std::pair<int, int>{5, 4}, {1, 0}, {2, 1}, {4, 3}, {3, 2}});
@@ -233,6 +276,152 @@ TEST(map_swap, swap_test_0) {
   }
 }
 
+TEST(map_swap, swap_steals_nodes) {
+  static_assert(std::is_nothrow_move_constructible<map<int, int>>::value,
+                "map move must be noexcept");
+  static_assert(std::is_nothrow_move_assignable<map<int, int>>::value,
+                "map move assignment must be noexcept");
+  map<int, int> one;
+  map<int, int> another({{100, 1}, {200, 2}});
+  for (int i = 0; i < 1000; ++i) one.insert(i, i * 2);
+  const int* first = &one.begin()->second;
+  one.swap(another);
+  // узлы не копируются: итераторы и адреса остаются прежними
+  EXPECT_EQ(&another.begin()->second, first);
+  EXPECT_EQ(another.size(), 1000u);
+  EXPECT_EQ(one.size(), 2u);
+  EXPECT_EQ(one.at(200), 2);
+  map<int, int> moved(std::move(another));
+  EXPECT_EQ(&moved.begin()->second, first);
+  EXPECT_TRUE(another.empty());
+  EXPECT_EQ(moved.nth_element(999)->second, 1998);
+  one = std::move(moved);
+  EXPECT_EQ(one.size(), 1000u);
+  EXPECT_EQ(&one.begin()->second, first);
+  one.swap(one);
+  EXPECT_EQ(one.size(), 1000u);
+  another.insert(5, 5);
+  EXPECT_EQ(another.at(5), 5);
+  s21::vector<map<int, int>> maps;
+  for (int i = 0; i < 20; ++i) maps.push_back(one);
+  EXPECT_EQ(maps[19].size(), 1000u);
+}
+
+TEST(map_constructor, sorted_range) {
+  std::vector<std::pair<int, std::string>> items;
+  for (int i = 0; i < 5000; ++i) items.push_back({i * 2, std::to_string(i)});
+  map<int, std::string> sorted(items.begin(), items.end());
+  EXPECT_EQ(sorted.size(), items.size());
+  EXPECT_EQ(sorted.at(4000), "2000");
+  EXPECT_EQ(sorted.nth_element(4999)->first, 9998);
+  sorted.insert(1, "one");
+  EXPECT_EQ(sorted.rank(2), 2u);
+  // неупорядоченный диапазон с повтором ключа: первый экземпляр остаётся
+  std::pair<int, std::string> mixed[] = {{3, "a"}, {1, "b"}, {3, "c"}};
+  map<int, std::string> unsorted(std::begin(mixed), std::end(mixed));
+  EXPECT_EQ(unsorted.size(), 2u);
+  EXPECT_EQ(unsorted.at(3), "a");
+  EXPECT_EQ(unsorted.begin()->first, 1);
+  map<int, std::string> copy(sorted);
+  EXPECT_EQ(copy.size(), sorted.size());
+  auto j = sorted.begin();
+  for (auto i = copy.begin(); i != copy.end(); ++i, ++j) {
+    EXPECT_EQ(i->first, j->first);
+    EXPECT_EQ(i->second, j->second);
+  }
+  EXPECT_EQ(--copy.end(), copy.nth_element(copy.size() - 1));
+  copy.erase(copy.find(0));
+  EXPECT_EQ(copy.size(), sorted.size() - 1);
+  unsorted = sorted;
+  EXPECT_EQ(unsorted.at(1), "one");
+}
+
+TEST(map_lookup, bounds_and_count) {
+  map<int, char> m({{1, 'a'}, {3, 'b'}, {5, 'c'}});
+  EXPECT_EQ(m.lower_bound(3)->second, 'b');
+  EXPECT_EQ(m.lower_bound(4)->first, 5);
+  EXPECT_EQ(m.upper_bound(3)->first, 5);
+  EXPECT_TRUE(m.upper_bound(5) == m.end());
+  EXPECT_EQ(m.count(1), 1u);
+  EXPECT_EQ(m.count(2), 0u);
+  auto range = m.equal_range(1);
+  EXPECT_EQ(range.first->second, 'a');
+  EXPECT_EQ(range.second->first, 3);
+}
+
+// ключ, считающий свои копирования
+struct CountedKey {
+  static int copies;
+  int id;
+  explicit CountedKey(int id) : id(id) {}
+  CountedKey(const CountedKey& other) : id(other.id) { ++copies; }
+  CountedKey(CountedKey&& other) noexcept : id(other.id) {}
+  bool operator<(const CountedKey& other) const { return id < other.id; }
+  bool operator==(const CountedKey& other) const { return id == other.id; }
+};
+int CountedKey::copies = 0;
+
+TEST(map_insert, emplace_without_key_copies) {
+  map<CountedKey, std::string> m;
+  CountedKey::copies = 0;
+  for (int i = 0; i < 1000; ++i) {
+    m.emplace(CountedKey(i), std::to_string(i));
+    m.try_emplace(CountedKey(i + 1000), "x");
+    m.insert(std::make_pair(CountedKey(i + 2000), std::string("y")));
+  }
+  EXPECT_EQ(m.size(), 3000u);
+  CountedKey probe(500);
+  EXPECT_TRUE(m.contains(probe));
+  EXPECT_EQ(m.at(probe), "500");
+  EXPECT_EQ(m.find(CountedKey(1500))->second, "x");
+  EXPECT_EQ(CountedKey::copies, 0);
+  // повторный ключ: значение не создаётся и не меняется
+  auto res = m.try_emplace(CountedKey(7), "ignored");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first->second, "7");
+  EXPECT_FALSE(m.emplace(CountedKey(7), "other").second);
+  EXPECT_EQ(m.at(CountedKey(7)), "7");
+  std::string big(100, 'z');
+  m.insert_or_assign(CountedKey(7), std::move(big));
+  EXPECT_EQ(m.at(CountedKey(7)), std::string(100, 'z'));
+  EXPECT_EQ(CountedKey::copies, 0);
+  m.insert(CountedKey(9000), "copied");
+  EXPECT_EQ(CountedKey::copies, 1);  // ровно одна копия в узел
+}
+
+TEST(map_insert, hinted_append) {
+  map<int, int> m;
+  for (int i = 0; i < 100000; ++i) m.emplace_hint(m.end(), i, i * 3);
+  EXPECT_EQ(m.size(), 100000u);
+  int expected = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, ++expected) {
+    ASSERT_EQ(it->first, expected);
+  }
+  EXPECT_EQ(m.nth_element(50000)->second, 150000);
+  EXPECT_EQ(m.rank(70000), 70000u);
+  // неверные подсказки и повторы
+  auto it = m.insert(m.begin(), std::make_pair(-5, 1));
+  EXPECT_EQ(it->first, -5);
+  it = m.insert(m.end(), std::make_pair(-3, 2));
+  EXPECT_EQ(it->first, -3);
+  it = m.insert(m.find(10), std::make_pair(10, 7));
+  EXPECT_EQ(it->second, 30);
+  it = m.emplace_hint(m.find(-3), -4, 9);
+  EXPECT_EQ(it, m.nth_element(1));
+  EXPECT_EQ(m.size(), 100003u);
+  EXPECT_EQ(m.begin()->first, -5);
+}
+
+TEST(map_lookup, transparent_string_view) {
+  map<std::string, int> routes({{"/api", 1}, {"/home", 2}});
+  std::string_view path("/home/extra", 5);
+  EXPECT_TRUE(routes.contains(path));
+  EXPECT_EQ(routes.find(path)->second, 2);
+  EXPECT_EQ(routes.count("/api"), 1u);
+  EXPECT_TRUE(routes.find("/none") == routes.end());
+  EXPECT_EQ(routes.lower_bound(std::string_view("/b"))->first, "/home");
+}
+
 TEST(map_merge, merge_test_0) {
   s21::map<int, int> _first(
       {std::pair<int, int>{5, 4}, {1, 0}, {2, 1}, {4, 3}, {3, 2}});
@@ -5,7 +5,8 @@
 #include "../s21_vector/s21_vector.h"
 
 namespace s21 {
-template <typename Key>
+template <typename Key, typename Compare = std::less<>,
+          typename Allocator = std::allocator<Key>>
 class multiset {
  public:
   class Multiset_Iterator;
@@ -14,19 +15,26 @@ class multiset {
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = multiset<Key>::Multiset_Iterator;
+  using iterator = multiset<Key, Compare, Allocator>::Multiset_Iterator;
   using const_iterator = Const_Multiset_Iterator;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
 
  private:
-  Tree<key_type, value_type> _tree;
+  using tree_type = Tree<key_type, value_type, Compare, Allocator>;
+  tree_type _tree;
   std::pair<iterator, bool> insert_pair(const value_type& value);
+  static const Key& key_of(const value_type& value) { return value; }
 
  public:
   multiset();
+  explicit multiset(const Compare& comp);
   multiset(std::initializer_list<value_type> const& items);
+  template <typename ForwardIt>
+  multiset(ForwardIt first, ForwardIt last);
   multiset(const multiset& other);
-  multiset(multiset&& other);
+  multiset(multiset&& other) noexcept;
   ~multiset();
 
   multiset& operator=(const multiset& s);
@@ -38,34 +46,63 @@ class multiset {
   const_iterator cend() const;
 
   template <typename... Args>
-  vector<std::pair<typename multiset<Key>::iterator, bool>> insert_many(
-      Args&&... args);
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
   bool empty();
   size_type size();
   size_type max_size();
+  key_compare key_comp() const;
 
   void clear();
 
   iterator insert(const value_type& value);
+  iterator insert(value_type&& value);
+  template <typename... Args>
+  iterator emplace(Args&&... args);
+  // вставка перед hint: при верной подсказке без спуска от корня
+  iterator insert(iterator hint, const value_type& value);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
   void erase(iterator pos);
-  void swap(multiset& other);
+  void swap(multiset& other) noexcept;
   void merge(multiset& other);
 
   iterator find(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
   bool contains(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
+
+  iterator nth_element(size_type k);  // k-й по порядку элемент или end()
+  size_type rank(const Key& key);     // число ключей меньше key
+  size_type count_range(const Key& from, const Key& to);  // ключи из [from, to)
   size_type count(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K& key);
 
   iterator lower_bound(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K& key);
   iterator upper_bound(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K& key);
   std::pair<iterator, iterator> equal_range(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key);
 
   class Multiset_Iterator {
    public:
-    using iterator = multiset<Key>::Multiset_Iterator;
-    using tree_iterator = typename Tree<key_type, value_type>::Iterator;
+    using iterator = multiset<Key, Compare, Allocator>::Multiset_Iterator;
+    using tree_iterator = typename tree_type::Iterator;
     using const_tree_iterator =
-        typename Tree<key_type, value_type>::Const_Iterator;
+        typename tree_type::Const_Iterator;
     Multiset_Iterator() = default;
     Multiset_Iterator(tree_iterator it);
     Multiset_Iterator(const_tree_iterator it);
@@ -86,15 +123,15 @@ class multiset {
 
    private:
     tree_iterator it;
-    friend void multiset<Key>::erase(iterator pos);
+    friend class multiset<Key, Compare, Allocator>;
   };
 
   class Const_Multiset_Iterator {
    public:
-    using tree_iterator = typename Tree<key_type, value_type>::Iterator;
+    using tree_iterator = typename tree_type::Iterator;
     using const_iterator = Const_Multiset_Iterator;
     using const_tree_iterator =
-        typename Tree<key_type, value_type>::Const_Iterator;
+        typename tree_type::Const_Iterator;
     Const_Multiset_Iterator() = default;
     // typename multiset<Key>::Const_Multiset_Iterator &operator=(const typename
     // multiset<Key>::Const_Multiset_Iterator &other);
@@ -118,45 +155,49 @@ class multiset {
   };
 };
 
-template <typename Key>
-inline std::pair<typename multiset<Key>::iterator, bool>
-multiset<Key>::insert_pair(const value_type& value) {
-  return std::make_pair<multiset<Key>::iterator, bool>(insert(value), true);
+template <typename Key, typename Compare, typename Allocator>
+inline std::pair<typename multiset<Key, Compare, Allocator>::iterator, bool>
+multiset<Key, Compare, Allocator>::insert_pair(const value_type& value) {
+  return std::make_pair<iterator, bool>(insert(value), true);
 }
 
-template <typename Key>
-multiset<Key>::multiset() : _tree() {}
+template <typename Key, typename Compare, typename Allocator>
+multiset<Key, Compare, Allocator>::multiset() : _tree() {}
 
-template <typename Key>
-multiset<Key>::multiset(std::initializer_list<value_type> const& items) {
-  // _tree = Tree<key_type, value_type>();
-  // for (const value_type& item : items)  {
-  //     if (!contains(item)) insert(item);
-  // }
-  _tree = Tree<key_type, value_type>(items);
-}
+template <typename Key, typename Compare, typename Allocator>
+multiset<Key, Compare, Allocator>::multiset(const Compare& comp)
+    : _tree(comp) {}
 
-template <typename Key>
-multiset<Key>::multiset(const multiset& other) {
-  _tree = Tree<key_type, value_type>(other._tree);
+template <typename Key, typename Compare, typename Allocator>
+multiset<Key, Compare, Allocator>::multiset(
+    std::initializer_list<value_type> const& items) {
+  _tree.assign_range(items.begin(), items.end(), key_of, false);
 }
 
-template <typename Key>
-multiset<Key>::multiset(multiset&& other) {
-  // Tree<key_type, value_type> tmp(_tree);
-  _tree = std::move(other._tree);
-  // _tree = tmp;
-  // tmp.clean();
+// упорядоченный диапазон строится за O(n)
+template <typename Key, typename Compare, typename Allocator>
+template <typename ForwardIt>
+multiset<Key, Compare, Allocator>::multiset(ForwardIt first, ForwardIt last) {
+  _tree.assign_range(first, last, key_of, false);
 }
 
-template <typename Key>
-multiset<Key>::~multiset() {
+template <typename Key, typename Compare, typename Allocator>
+multiset<Key, Compare, Allocator>::multiset(const multiset& other)
+    : _tree(other._tree) {}
+
+template <typename Key, typename Compare, typename Allocator>
+multiset<Key, Compare, Allocator>::multiset(multiset&& other) noexcept
+    : _tree(std::move(other._tree)) {}
+
+template <typename Key, typename Compare, typename Allocator>
+multiset<Key, Compare, Allocator>::~multiset() {
   // std::cout  <<  "Set destructor!" << std::endl;
   _tree.clean();
 }
 
-template <typename Key>
-multiset<Key>& multiset<Key>::operator=(const multiset& s) {
+template <typename Key, typename Compare, typename Allocator>
+multiset<Key, Compare, Allocator>& multiset<Key, Compare, Allocator>::operator=(
+    const multiset& s) {
   if (this == &s) {
     return *this;
   }
@@ -164,8 +205,9 @@ multiset<Key>& multiset<Key>::operator=(const multiset& s) {
   return *this;
 }
 
-template <typename Key>
-multiset<Key>& multiset<Key>::operator=(multiset&& s) noexcept {
+template <typename Key, typename Compare, typename Allocator>
+multiset<Key, Compare, Allocator>& multiset<Key, Compare, Allocator>::operator=(
+    multiset&& s) noexcept {
   if (this == &s) {
     return *this;
   }
@@ -173,35 +215,42 @@ multiset<Key>& multiset<Key>::operator=(multiset&& s) noexcept {
   return *this;
 }
 
-template <typename Key>
-inline bool s21::multiset<Key>::empty() {
+template <typename Key, typename Compare, typename Allocator>
+inline bool s21::multiset<Key, Compare, Allocator>::empty() {
   return _tree.empty();
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::size() {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::size_type
+multiset<Key, Compare, Allocator>::size() {
   return _tree.size();
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::max_size() {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::size_type
+multiset<Key, Compare, Allocator>::max_size() {
   return _tree.max_size();
 }
 
-template <typename Key>
-void multiset<Key>::clear() {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::key_compare
+multiset<Key, Compare, Allocator>::key_comp() const {
+  return _tree.key_comp();
+}
+
+template <typename Key, typename Compare, typename Allocator>
+void multiset<Key, Compare, Allocator>::clear() {
   _tree.clean();
-  // _tree = Tree<key_type, value_type>();
+  // _tree = tree_type();
 }
 
-template <typename Key>
-void multiset<Key>::swap(multiset& other) {
-  if (this == &other) throw std::invalid_argument("swap");
+template <typename Key, typename Compare, typename Allocator>
+void multiset<Key, Compare, Allocator>::swap(multiset& other) noexcept {
   _tree.swap(other._tree);
 }
 
-template <typename Key>
-void multiset<Key>::merge(multiset& other) {
+template <typename Key, typename Compare, typename Allocator>
+void multiset<Key, Compare, Allocator>::merge(multiset& other) {
   if (this == &other) throw std::invalid_argument("merge");
   _tree.merge(other._tree);
   other.clear();
@@ -210,160 +259,213 @@ void multiset<Key>::merge(multiset& other) {
   // }
 }
 
-template <typename Key>
-void multiset<Key>::erase(iterator pos) {
+template <typename Key, typename Compare, typename Allocator>
+void multiset<Key, Compare, Allocator>::erase(iterator pos) {
   _tree.erase(pos.it);
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::find(const Key& key) {
-  auto node = _tree.find(key);
-  if (node == nullptr) return end();
-  auto iter = _tree.begin();
-  auto it_end = _tree.end();
-  while (iter != it_end) {
-    if (iter.get_node()->key == key) break;
-    ++iter;
-  }
-  return iterator(iter);
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::find(const Key& key) {
+  return iterator(_tree.find_iterator(key));
 }
 
-template <typename Key>
-bool multiset<Key>::contains(const Key& key) {
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::find(const K& key) {
+  return iterator(_tree.find_iterator(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+bool multiset<Key, Compare, Allocator>::contains(const Key& key) {
   return _tree.contains(key);
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::count(const Key& key) {
-  size_type count = 0;
-  auto it = find(key);
-  auto it_end = _tree.end();
-  while (it != it_end) {
-    if (*it > key) break;
-    if (*it == key) {
-      ++count;
-      ++it;
-    }
-  }
-  return count;
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+bool multiset<Key, Compare, Allocator>::contains(const K& key) {
+  return _tree.contains(key);
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::lower_bound(const Key& key) {
-  auto it = begin();
-  while (it != end() && *it < key) {
-    ++it;
-  }
-  return it;
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::nth_element(size_type k) {
+  return iterator(_tree.nth_element(k));
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::upper_bound(const Key& key) {
-  auto it = begin();
-  while (it != end() && *it <= key) {
-    ++it;
-  }
-  return it;
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::size_type
+multiset<Key, Compare, Allocator>::rank(const Key& key) {
+  return _tree.rank(key);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::size_type
+multiset<Key, Compare, Allocator>::count_range(const Key& from, const Key& to) {
+  return _tree.count_range(from, to);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::size_type
+multiset<Key, Compare, Allocator>::count(const Key& key) {
+  return _tree.count(key);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename multiset<Key, Compare, Allocator>::size_type
+multiset<Key, Compare, Allocator>::count(const K& key) {
+  return _tree.count(key);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::lower_bound(const Key& key) {
+  return iterator(_tree.lower_bound(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::lower_bound(const K& key) {
+  return iterator(_tree.lower_bound(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::upper_bound(const Key& key) {
+  return iterator(_tree.upper_bound(key));
 }
 
-template <typename Key>
-std::pair<typename multiset<Key>::iterator, typename multiset<Key>::iterator>
-multiset<Key>::equal_range(const Key& key) {
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::upper_bound(const K& key) {
+  return iterator(_tree.upper_bound(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+std::pair<typename multiset<Key, Compare, Allocator>::iterator,
+          typename multiset<Key, Compare, Allocator>::iterator>
+multiset<Key, Compare, Allocator>::equal_range(const Key& key) {
   auto lower = lower_bound(key);
   auto upper = upper_bound(key);
   return std::make_pair(lower, upper);
 }
 
-template <typename Key>
-inline multiset<Key>::Multiset_Iterator::Multiset_Iterator(tree_iterator it)
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+std::pair<typename multiset<Key, Compare, Allocator>::iterator,
+          typename multiset<Key, Compare, Allocator>::iterator>
+multiset<Key, Compare, Allocator>::equal_range(const K& key) {
+  auto lower = lower_bound(key);
+  auto upper = upper_bound(key);
+  return std::make_pair(lower, upper);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+inline multiset<Key, Compare, Allocator>::Multiset_Iterator::Multiset_Iterator(
+    tree_iterator it)
     : it(it) {}
 
-template <typename Key>
-inline multiset<Key>::Multiset_Iterator::Multiset_Iterator(
+template <typename Key, typename Compare, typename Allocator>
+inline multiset<Key, Compare, Allocator>::Multiset_Iterator::Multiset_Iterator(
     const_tree_iterator it)
     : it(it) {}
 
-template <typename Key>
-typename multiset<Key>::Multiset_Iterator&
-multiset<Key>::Multiset_Iterator::operator++() {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::Multiset_Iterator&
+multiset<Key, Compare, Allocator>::Multiset_Iterator::operator++() {
   ++it;
   return *this;
 }
 
-template <typename Key>
-typename multiset<Key>::Multiset_Iterator&
-multiset<Key>::Multiset_Iterator::operator--() {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::Multiset_Iterator&
+multiset<Key, Compare, Allocator>::Multiset_Iterator::operator--() {
   --it;
   return *this;
 }
 
-template <typename Key>
-typename multiset<Key>::Multiset_Iterator
-multiset<Key>::Multiset_Iterator::operator++(int) {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::Multiset_Iterator
+multiset<Key, Compare, Allocator>::Multiset_Iterator::operator++(int) {
   return it++;
 }
 
-template <typename Key>
-typename multiset<Key>::Multiset_Iterator
-multiset<Key>::Multiset_Iterator::operator--(int) {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::Multiset_Iterator
+multiset<Key, Compare, Allocator>::Multiset_Iterator::operator--(int) {
   return it--;
 }
 
-template <typename Key>
-bool multiset<Key>::Multiset_Iterator::operator==(const iterator& other) const {
+template <typename Key, typename Compare, typename Allocator>
+bool multiset<Key, Compare, Allocator>::Multiset_Iterator::operator==(
+    const iterator& other) const {
   return it == other.it;
 }
 
-template <typename Key>
-inline bool multiset<Key>::Multiset_Iterator::operator!=(
+template <typename Key, typename Compare, typename Allocator>
+inline bool multiset<Key, Compare, Allocator>::Multiset_Iterator::operator!=(
     const iterator& other) const {
   return it != other.it;
 }
 
-template <typename Key>
-typename multiset<Key>::const_reference
-multiset<Key>::Multiset_Iterator::operator*() const {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::const_reference
+multiset<Key, Compare, Allocator>::Multiset_Iterator::operator*() const {
   if (it.get_node() == nullptr)
     throw std::out_of_range("Multiset_Iterator::operator*()");
   return *it;
 }
 
-template <typename Key>
-const typename multiset<Key>::value_type*
-multiset<Key>::Multiset_Iterator::operator->() const {
+template <typename Key, typename Compare, typename Allocator>
+const typename multiset<Key, Compare, Allocator>::value_type*
+multiset<Key, Compare, Allocator>::Multiset_Iterator::operator->() const {
   return &(it->value);
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::insert(
-    const value_type& value) {
-  _tree.__insert(value, value);
-  auto it = _tree.begin();
-  auto it_end = _tree.end();
-  while (it != it_end) {
-    if (*it == value) break;
-    ++it;
-  }
-  return iterator(it);
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::insert(const value_type& value) {
+  return iterator(_tree.emplace_equal(value));  // после равных ему
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::begin() {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::insert(value_type&& value) {
+  return iterator(_tree.emplace_equal(std::move(value)));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename... Args>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::emplace(Args&&... args) {
+  return iterator(_tree.emplace_equal(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::begin() {
   return iterator(_tree.begin());
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::end() {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::end() {
   return iterator(_tree.end());
 }
 
-template <typename Key>
-typename multiset<Key>::const_iterator multiset<Key>::cbegin() const {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::const_iterator
+multiset<Key, Compare, Allocator>::cbegin() const {
   return const_iterator(_tree.cbegin());
 }
 
-template <typename Key>
-typename multiset<Key>::const_iterator multiset<Key>::cend() const {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::const_iterator
+multiset<Key, Compare, Allocator>::cend() const {
   return const_iterator(_tree.cend());
 }
 
@@ -373,73 +475,74 @@ typename multiset<Key>::const_iterator multiset<Key>::cend() const {
 //
 //
 
-template <typename Key>
-inline multiset<Key>::Const_Multiset_Iterator::Const_Multiset_Iterator(
-    tree_iterator it)
+template <typename Key, typename Compare, typename Allocator>
+inline multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::
+    Const_Multiset_Iterator(tree_iterator it)
     : it(it) {}
 
-template <typename Key>
-inline multiset<Key>::Const_Multiset_Iterator::Const_Multiset_Iterator(
-    const_tree_iterator it)
+template <typename Key, typename Compare, typename Allocator>
+inline multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::
+    Const_Multiset_Iterator(const_tree_iterator it)
     : it(it){};
 
-template <typename Key>
-typename multiset<Key>::Const_Multiset_Iterator&
-multiset<Key>::Const_Multiset_Iterator::operator++() {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::Const_Multiset_Iterator&
+multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::operator++() {
   ++it;
   return *this;
 }
 
-template <typename Key>
-typename multiset<Key>::Const_Multiset_Iterator&
-multiset<Key>::Const_Multiset_Iterator::operator--() {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::Const_Multiset_Iterator&
+multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::operator--() {
   --it;
   return *this;
 }
 
-template <typename Key>
-typename multiset<Key>::Const_Multiset_Iterator
-multiset<Key>::Const_Multiset_Iterator::operator++(int) {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::Const_Multiset_Iterator
+multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::operator++(int) {
   return it++;
 }
 
-template <typename Key>
-typename multiset<Key>::Const_Multiset_Iterator
-multiset<Key>::Const_Multiset_Iterator::operator--(int) {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::Const_Multiset_Iterator
+multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::operator--(int) {
   return it--;
 }
 
-template <typename Key>
-bool multiset<Key>::Const_Multiset_Iterator::operator==(
+template <typename Key, typename Compare, typename Allocator>
+bool multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::operator==(
     const const_iterator& other) const {
   return it == other.it;
 }
 
-template <typename Key>
-inline bool multiset<Key>::Const_Multiset_Iterator::operator!=(
+template <typename Key, typename Compare, typename Allocator>
+inline bool
+multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::operator!=(
     const const_iterator& other) const {
   return it != other.it;
 }
 
-template <typename Key>
-typename multiset<Key>::const_reference
-multiset<Key>::Const_Multiset_Iterator::operator*() const {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::const_reference
+multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::operator*() const {
   if (it.get_node() == nullptr)
     throw std::out_of_range("Const_Multiset_Iterator::operator*()");
   return *it;
 }
 
-template <typename Key>
-typename multiset<Key>::value_type*
-multiset<Key>::Const_Multiset_Iterator::operator->() const {
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::value_type*
+multiset<Key, Compare, Allocator>::Const_Multiset_Iterator::operator->() const {
   return &(it->value);
 }
 
-template <typename Key>
+template <typename Key, typename Compare, typename Allocator>
 template <typename... Args>
-vector<std::pair<typename multiset<Key>::iterator, bool>>
-multiset<Key>::insert_many(Args&&... args) {
-  vector<std::pair<typename multiset<Key>::iterator, bool>> result_vector;
+vector<std::pair<typename multiset<Key, Compare, Allocator>::iterator, bool>>
+multiset<Key, Compare, Allocator>::insert_many(Args&&... args) {
+  vector<std::pair<iterator, bool>> result_vector;
   result_vector.reserve(sizeof...(args));
   auto args_tuple = std::make_tuple(std::forward<Args>(args)...);
   std::apply(
@@ -452,4 +555,19 @@ multiset<Key>::insert_many(Args&&... args) {
 
   return result_vector;
 }
+template <typename Key, typename Compare, typename Allocator>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::insert(iterator hint,
+                                          const value_type& value) {
+  return emplace_hint(hint, value);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename... Args>
+typename multiset<Key, Compare, Allocator>::iterator
+multiset<Key, Compare, Allocator>::emplace_hint(iterator hint, Args&&... args) {
+  return iterator(
+      _tree.emplace_hint_equal(hint.it, std::forward<Args>(args)...));
+}
+
 }  // namespace s21
\ No newline at end of file
@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cctype>
+#include <set>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -130,3 +134,150 @@ TEST(s21_multiset, swap_1) {
   test_eq<int>(a, std_a);
   test_eq<int>(b, std_b);
 }
+
+TEST(s21_multiset, order_statistics) {
+  multiset<int> a{1, 1, 2, 3, 3, 3, 4, 5, 5, 9};
+  EXPECT_EQ(a.size(), 10u);
+  EXPECT_EQ(*a.nth_element(0), 1);
+  EXPECT_EQ(*a.nth_element(5), 3);
+  EXPECT_EQ(*a.nth_element(9), 9);
+  EXPECT_EQ(a.rank(3), 3u);
+  EXPECT_EQ(a.rank(4), 6u);
+  EXPECT_EQ(a.count_range(3, 5), 4u);
+  EXPECT_EQ(a.count_range(0, 100), 10u);
+}
+
+TEST(s21_multiset, sorted_range) {
+  std::vector<int> keys;
+  for (int i = 0; i < 3000; ++i) keys.push_back(i / 3);
+  multiset<int> a(keys.begin(), keys.end());
+  EXPECT_EQ(a.size(), keys.size());
+  EXPECT_EQ(a.count_range(10, 11), 3u);
+  EXPECT_EQ(*a.nth_element(2999), 999);
+  multiset<int> b(a);
+  std::size_t k = 0;
+  for (auto it = b.begin(); it != b.end(); ++it, ++k) EXPECT_EQ(*it, keys[k]);
+  multiset<int> c({5, 1, 5, 3});
+  EXPECT_EQ(c.size(), 4u);
+  EXPECT_EQ(*c.begin(), 1);
+  EXPECT_EQ(c.count_range(5, 6), 2u);
+}
+
+TEST(s21_multiset, bounds_and_count) {
+  multiset<int> a;
+  std::multiset<int> std_a;
+  for (int i = 0; i < 2000; ++i) {
+    int key = (i * 7) % 301;
+    a.insert(key);
+    std_a.insert(key);
+  }
+  for (int key = -1; key <= 302; ++key) {
+    EXPECT_EQ(a.count(key), std_a.count(key));
+    auto lower = a.lower_bound(key);
+    auto upper = a.upper_bound(key);
+    if (std_a.lower_bound(key) == std_a.end()) {
+      EXPECT_TRUE(lower == a.end());
+    } else {
+      EXPECT_EQ(*lower, *std_a.lower_bound(key));
+    }
+    if (std_a.upper_bound(key) == std_a.end()) {
+      EXPECT_TRUE(upper == a.end());
+    } else {
+      EXPECT_EQ(*upper, *std_a.upper_bound(key));
+    }
+    auto range = a.equal_range(key);
+    EXPECT_TRUE(range.first == lower);
+    EXPECT_TRUE(range.second == upper);
+  }
+  multiset<int> empty;
+  EXPECT_EQ(empty.count(1), 0u);
+  EXPECT_TRUE(empty.lower_bound(1) == empty.end());
+}
+
+TEST(s21_multiset, emplace) {
+  multiset<std::string> a;
+  std::string key(50, 'k');
+  auto first = a.insert(key);
+  auto second = a.emplace(50, 'k');
+  auto third = a.insert(std::move(key));
+  EXPECT_EQ(a.size(), 3u);
+  EXPECT_EQ(a.count(std::string(50, 'k')), 3u);
+  // равные ключи идут в порядке вставки
+  EXPECT_TRUE(++first == second);
+  EXPECT_TRUE(++second == third);
+}
+
+TEST(s21_multiset, hinted_insert) {
+  multiset<int> a;
+  std::multiset<int> std_a;
+  unsigned seed = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = (seed >> 8) % 500;
+    // подсказка то верная, то случайная
+    auto hint = i % 3 ? a.upper_bound(key) : a.nth_element(seed % (i + 1));
+    auto it = a.insert(hint, key);
+    std_a.insert(key);
+    ASSERT_EQ(*it, key);
+  }
+  EXPECT_EQ(a.size(), std_a.size());
+  auto std_it = std_a.begin();
+  for (auto it = a.begin(); it != a.end(); ++it, ++std_it) {
+    ASSERT_EQ(*it, *std_it);
+  }
+  for (int key = 0; key < 500; ++key) {
+    EXPECT_EQ(a.count(key), std_a.count(key));
+  }
+  // равные ключи встают перед подсказкой
+  multiset<int> b({1, 1, 1});
+  auto second = ++b.begin();
+  auto it = b.emplace_hint(second, 1);
+  EXPECT_TRUE(++it == second);
+}
+
+struct CaseLess {
+  bool operator()(const std::string &a, const std::string &b) const {
+    return std::lexicographical_compare(
+        a.begin(), a.end(), b.begin(), b.end(),
+        [](char x, char y) { return std::tolower(x) < std::tolower(y); });
+  }
+};
+
+struct ByFirst {
+  bool operator()(const std::pair<int, int> &a,
+                  const std::pair<int, int> &b) const {
+    return a.first < b.first;
+  }
+};
+
+TEST(s21_multiset, erase_exact_equivalent) {
+  multiset<std::string, CaseLess> m{"A"};
+  auto it = m.insert("a");
+  m.erase(it);
+  ASSERT_EQ(m.size(), 1u);
+  EXPECT_EQ(*m.begin(), "A");
+
+  // удаление по итераторам среди равных по Compare элементов
+  multiset<std::pair<int, int>, ByFirst> a;
+  std::multiset<std::pair<int, int>, ByFirst> std_a;
+  unsigned seed = 777;
+  for (int i = 0; i < 3000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    std::pair<int, int> item((seed >> 8) % 50, i);
+    a.insert(item);
+    std_a.insert(item);
+  }
+  for (int i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    size_t index = (seed >> 8) % std_a.size();
+    auto it_a = a.begin();
+    auto std_it = std_a.begin();
+    for (size_t k = 0; k < index; ++k, ++it_a, ++std_it) {
+    }
+    ASSERT_EQ(*it_a, *std_it);
+    a.erase(it_a);
+    std_a.erase(std_it);
+  }
+  ASSERT_EQ(a.size(), std_a.size());
+  EXPECT_TRUE(std::equal(std_a.begin(), std_a.end(), a.begin()));
+}
@@ -1,11 +1,11 @@
 #ifndef S21_QUEUE_S21_QUEUE_H_
 #define S21_QUEUE_S21_QUEUE_H_
 
-#include "../s21_vector/s21_vector.h"
+#include "../s21_ring_buffer/s21_ring_buffer.h"
 
 namespace s21 {
 
-template <class T, class Vector = s21::vector<T>>
+template <class T, class Container = s21::ring_buffer<T>>
 class queue {
  public:
   using value_type = T;
@@ -34,74 +34,74 @@ class queue {
   void insert_many_back(Args &&...args);
 
  private:
-  Vector head;
+  Container head;
 };
 
 }  // namespace s21
 namespace s21 {
-template <class T, class Vector>
-queue<T, Vector>::queue() : head() {}
+template <class T, class Container>
+queue<T, Container>::queue() : head() {}
 
-template <class T, class Vector>
-queue<T, Vector>::queue(std::initializer_list<value_type> const &items)
+template <class T, class Container>
+queue<T, Container>::queue(std::initializer_list<value_type> const &items)
     : head(items) {}
 
-template <class T, class Vector>
-queue<T, Vector>::queue(const queue &q) : head(q.head) {}
+template <class T, class Container>
+queue<T, Container>::queue(const queue &q) : head(q.head) {}
 
-template <class T, class Vector>
-queue<T, Vector>::queue(queue &&q) : head(std::move(q.head)) {}
+template <class T, class Container>
+queue<T, Container>::queue(queue &&q) : head(std::move(q.head)) {}
 
-template <class T, class Vector>
-queue<T, Vector>::~queue() {}
+template <class T, class Container>
+queue<T, Container>::~queue() {}
 
-template <class T, class Vector>
-queue<T, Vector> &queue<T, Vector>::operator=(queue &&q) {
+template <class T, class Container>
+queue<T, Container> &queue<T, Container>::operator=(queue &&q) {
   this->head = std::move(q.head);
   return *this;
 }
 
-template <class T, class Vector>
-typename queue<T, Vector>::size_type queue<T, Vector>::size() {
+template <class T, class Container>
+typename queue<T, Container>::size_type queue<T, Container>::size() {
   return head.size();
 }
 
-template <typename T, typename Vector>
-typename queue<T, Vector>::const_reference queue<T, Vector>::front() {
+template <typename T, typename Container>
+typename queue<T, Container>::const_reference queue<T, Container>::front() {
   return head.front();
 }
 
-template <typename T, typename Vector>
-typename queue<T, Vector>::const_reference queue<T, Vector>::back() {
+template <typename T, typename Container>
+typename queue<T, Container>::const_reference queue<T, Container>::back() {
   return head.back();
 }
 
-template <class T, class Vector>
-void queue<T, Vector>::push(const_reference value) {
+template <class T, class Container>
+void queue<T, Container>::push(const_reference value) {
   this->head.push_back(value);
 }
 
-template <typename T, class Vector>
-void queue<T, Vector>::pop() {
+template <typename T, class Container>
+void queue<T, Container>::pop() {
   if (empty()) {
     throw std::out_of_range("Queue is empty");
   }
-  head.erase(head.begin());
+  head.erase(head.begin());  // у ring_buffer удаление головы - O(1)
 }
 
-template <class T, class Vector>
-bool queue<T, Vector>::empty() {
+template <class T, class Container>
+bool queue<T, Container>::empty() {
   return head.empty();
 }
 
-template <class T, class Vector>
-void queue<T, Vector>::swap(queue &other) {
+template <class T, class Container>
+void queue<T, Container>::swap(queue &other) {
   this->head.swap(other.head);
 }
 
-template <class T, class Vector>
+template <class T, class Container>
 template <typename... Args>
-void queue<T, Vector>::insert_many_back(Args &&...args) {
+void queue<T, Container>::insert_many_back(Args &&...args) {
   head.insert_many_back(args...);
 }
 
@@ -0,0 +1,484 @@
+#ifndef S21_RING_BUFFER_S21_RING_BUFFER_H_
+#define S21_RING_BUFFER_S21_RING_BUFFER_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace s21 {
+
+// Кольцевой буфер: емкость - степень двойки, индексы заворачиваются маской,
+// поэтому push/pop с обоих концов - O(1) без сдвига элементов. При росте
+// кольцо разворачивается в новый буфер, голова снова в нуле.
+template <typename T>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  template <bool Const>
+  class RingIterator;
+  using iterator = RingIterator<false>;
+  using const_iterator = RingIterator<true>;
+
+  ring_buffer();
+  ring_buffer(std::initializer_list<value_type> const &items);
+  ring_buffer(const ring_buffer &other);
+  ring_buffer(ring_buffer &&other) noexcept;
+  ~ring_buffer();
+  ring_buffer &operator=(const ring_buffer &other);
+  ring_buffer &operator=(ring_buffer &&other) noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  void reserve(size_type size);
+
+  void clear();
+  iterator erase(iterator pos);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  template <typename... Args>
+  reference emplace_front(Args &&...args);
+  void pop_back();
+  void pop_front();
+  void swap(ring_buffer &other) noexcept;
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  static constexpr size_type kMinCapacity = 8;
+
+  T *slot(size_type pos) const;
+  void grow();
+  void reallocate(size_type capacity);
+
+  T *buffer_;
+  size_type head_;
+  size_type size_;
+  size_type capacity_;
+};
+
+template <typename T>
+template <bool Const>
+class ring_buffer<T>::RingIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T *, T *>;
+  using reference = std::conditional_t<Const, const T &, T &>;
+  using owner = std::conditional_t<Const, const ring_buffer, ring_buffer>;
+
+  RingIterator() : ring(nullptr), index(0) {}
+  RingIterator(owner *ring, size_type index) : ring(ring), index(index) {}
+  operator RingIterator<true>() const { return {ring, index}; }
+
+  reference operator*() const { return (*ring)[index]; }
+  pointer operator->() const { return &(*ring)[index]; }
+  reference operator[](difference_type n) const { return (*ring)[index + n]; }
+
+  RingIterator &operator++() {
+    ++index;
+    return *this;
+  }
+  RingIterator operator++(int) {
+    RingIterator copy = *this;
+    ++index;
+    return copy;
+  }
+  RingIterator &operator--() {
+    --index;
+    return *this;
+  }
+  RingIterator operator--(int) {
+    RingIterator copy = *this;
+    --index;
+    return copy;
+  }
+  RingIterator &operator+=(difference_type n) {
+    index += n;
+    return *this;
+  }
+  RingIterator &operator-=(difference_type n) {
+    index -= n;
+    return *this;
+  }
+  RingIterator operator+(difference_type n) const {
+    return RingIterator(ring, index + n);
+  }
+  RingIterator operator-(difference_type n) const {
+    return RingIterator(ring, index - n);
+  }
+  difference_type operator-(const RingIterator &other) const {
+    return static_cast<difference_type>(index) -
+           static_cast<difference_type>(other.index);
+  }
+
+  bool operator==(const RingIterator &other) const {
+    return ring == other.ring && index == other.index;
+  }
+  bool operator!=(const RingIterator &other) const {
+    return !(*this == other);
+  }
+  bool operator<(const RingIterator &other) const {
+    return index < other.index;
+  }
+  bool operator>(const RingIterator &other) const { return other < *this; }
+  bool operator<=(const RingIterator &other) const {
+    return !(other < *this);
+  }
+  bool operator>=(const RingIterator &other) const {
+    return !(*this < other);
+  }
+
+ private:
+  friend class ring_buffer;
+
+  owner *ring;
+  size_type index;  // логический номер элемента от головы
+};
+
+template <typename T>
+inline ring_buffer<T>::ring_buffer()
+    : buffer_(nullptr), head_(0), size_(0), capacity_(0) {}
+
+template <typename T>
+inline ring_buffer<T>::ring_buffer(
+    std::initializer_list<value_type> const &items)
+    : ring_buffer() {
+  reserve(items.size());
+  for (const auto &item : items) push_back(item);
+}
+
+template <typename T>
+inline ring_buffer<T>::ring_buffer(const ring_buffer &other) : ring_buffer() {
+  reserve(other.size_);
+  for (const auto &item : other) push_back(item);
+}
+
+template <typename T>
+inline ring_buffer<T>::ring_buffer(ring_buffer &&other) noexcept
+    : ring_buffer() {
+  swap(other);
+}
+
+template <typename T>
+inline ring_buffer<T>::~ring_buffer() {
+  clear();
+  if (buffer_) std::allocator<T>().deallocate(buffer_, capacity_);
+}
+
+template <typename T>
+inline ring_buffer<T> &ring_buffer<T>::operator=(const ring_buffer &other) {
+  if (this != &other) {
+    ring_buffer copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename T>
+inline ring_buffer<T> &ring_buffer<T>::operator=(
+    ring_buffer &&other) noexcept {
+  if (this != &other) {
+    ring_buffer moved(std::move(other));
+    swap(moved);
+  }
+  return *this;
+}
+
+// Адрес элемента с логическим номером pos
+template <typename T>
+inline T *ring_buffer<T>::slot(size_type pos) const {
+  return buffer_ + ((head_ + pos) & (capacity_ - 1));
+}
+
+template <typename T>
+inline typename ring_buffer<T>::reference ring_buffer<T>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out range");
+  }
+  return *slot(pos);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::const_reference ring_buffer<T>::at(
+    size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out range");
+  }
+  return *slot(pos);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::reference ring_buffer<T>::operator[](
+    size_type pos) {
+  return *slot(pos);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::const_reference ring_buffer<T>::operator[](
+    size_type pos) const {
+  return *slot(pos);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::reference ring_buffer<T>::front() {
+  return *slot(0);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::const_reference ring_buffer<T>::front() const {
+  return *slot(0);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::reference ring_buffer<T>::back() {
+  return *slot(size_ - 1);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::const_reference ring_buffer<T>::back() const {
+  return *slot(size_ - 1);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::iterator ring_buffer<T>::begin() {
+  return iterator(this, 0);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::iterator ring_buffer<T>::end() {
+  return iterator(this, size_);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::const_iterator ring_buffer<T>::begin() const {
+  return const_iterator(this, 0);
+}
+
+template <typename T>
+inline typename ring_buffer<T>::const_iterator ring_buffer<T>::end() const {
+  return const_iterator(this, size_);
+}
+
+template <typename T>
+inline bool ring_buffer<T>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T>
+inline typename ring_buffer<T>::size_type ring_buffer<T>::size() const {
+  return size_;
+}
+
+template <typename T>
+inline typename ring_buffer<T>::size_type ring_buffer<T>::max_size() const {
+  return std::numeric_limits<std::size_t>::max() / sizeof(value_type) / 2;
+}
+
+template <typename T>
+inline typename ring_buffer<T>::size_type ring_buffer<T>::capacity() const {
+  return capacity_;
+}
+
+// Емкость округляется вверх до степени двойки
+template <typename T>
+inline void ring_buffer<T>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("Too large size for reserve");
+  }
+  if (size > capacity_) {
+    size_type capacity = kMinCapacity;
+    while (capacity < size) capacity *= 2;
+    reallocate(capacity);
+  }
+}
+
+template <typename T>
+inline void ring_buffer<T>::grow() {
+  reallocate(capacity_ ? capacity_ * 2 : kMinCapacity);
+}
+
+// Разворачивает кольцо в новый буфер: элементы переносятся по порядку
+// от головы, перемещением, если оно не бросает исключений
+template <typename T>
+inline void ring_buffer<T>::reallocate(size_type capacity) {
+  T *fresh = std::allocator<T>().allocate(capacity);
+  size_type first = std::min(size_, capacity_ - head_);
+  constexpr bool kMove = std::is_nothrow_move_constructible_v<T> ||
+                        !std::is_copy_constructible_v<T>;
+  try {
+    if constexpr (kMove) {
+      std::uninitialized_move(buffer_ + head_, buffer_ + head_ + first, fresh);
+    } else {
+      std::uninitialized_copy(buffer_ + head_, buffer_ + head_ + first, fresh);
+    }
+    // если бросит перенос второй части, уже созданные в fresh элементы
+    // первой части разрушаются (бросающий перенос - у move-only типов)
+    try {
+      if constexpr (kMove) {
+        std::uninitialized_move(buffer_, buffer_ + size_ - first,
+                                fresh + first);
+      } else {
+        std::uninitialized_copy(buffer_, buffer_ + size_ - first,
+                                fresh + first);
+      }
+    } catch (...) {
+      std::destroy(fresh, fresh + first);
+      throw;
+    }
+  } catch (...) {
+    std::allocator<T>().deallocate(fresh, capacity);
+    throw;
+  }
+  if (buffer_) {
+    std::destroy(buffer_ + head_, buffer_ + head_ + first);
+    std::destroy(buffer_, buffer_ + size_ - first);
+    std::allocator<T>().deallocate(buffer_, capacity_);
+  }
+  buffer_ = fresh;
+  head_ = 0;
+  capacity_ = capacity;
+}
+
+// Память сохраняется для повторного заполнения
+template <typename T>
+inline void ring_buffer<T>::clear() {
+  while (size_) pop_back();
+  head_ = 0;
+}
+
+// Сдвигается меньшая из двух частей, поэтому удаление головы (pop
+// очереди) и хвоста - O(1)
+template <typename T>
+inline typename ring_buffer<T>::iterator ring_buffer<T>::erase(iterator pos) {
+  size_type index = pos.index;
+  if (index >= size_) {
+    throw std::out_of_range("Index out ot range");
+  }
+  if (index < size_ / 2) {
+    for (size_type i = index; i > 0; --i) {
+      *slot(i) = std::move(*slot(i - 1));
+    }
+    pop_front();
+  } else {
+    for (size_type i = index; i + 1 < size_; ++i) {
+      *slot(i) = std::move(*slot(i + 1));
+    }
+    pop_back();
+  }
+  return iterator(this, index);
+}
+
+template <typename T>
+inline void ring_buffer<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T>
+inline void ring_buffer<T>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T>
+inline void ring_buffer<T>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T>
+inline void ring_buffer<T>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+// Элемент строится до роста буфера: args могут ссылаться на элемент кольца
+template <typename T>
+template <typename... Args>
+inline typename ring_buffer<T>::reference ring_buffer<T>::emplace_back(
+    Args &&...args) {
+  if (size_ == capacity_) {
+    T value(std::forward<Args>(args)...);
+    grow();
+    ::new (static_cast<void *>(slot(size_))) T(std::move(value));
+  } else {
+    ::new (static_cast<void *>(slot(size_))) T(std::forward<Args>(args)...);
+  }
+  ++size_;
+  return back();
+}
+
+template <typename T>
+template <typename... Args>
+inline typename ring_buffer<T>::reference ring_buffer<T>::emplace_front(
+    Args &&...args) {
+  if (size_ == capacity_) {
+    T value(std::forward<Args>(args)...);
+    grow();
+    head_ = (head_ - 1) & (capacity_ - 1);
+    ::new (static_cast<void *>(buffer_ + head_)) T(std::move(value));
+  } else {
+    size_type head = (head_ - 1) & (capacity_ - 1);
+    ::new (static_cast<void *>(buffer_ + head)) T(std::forward<Args>(args)...);
+    head_ = head;
+  }
+  ++size_;
+  return front();
+}
+
+template <typename T>
+inline void ring_buffer<T>::pop_back() {
+  --size_;
+  slot(size_)->~T();
+}
+
+template <typename T>
+inline void ring_buffer<T>::pop_front() {
+  buffer_[head_].~T();
+  head_ = (head_ + 1) & (capacity_ - 1);
+  --size_;
+}
+
+template <typename T>
+inline void ring_buffer<T>::swap(ring_buffer &other) noexcept {
+  std::swap(buffer_, other.buffer_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+template <typename T>
+template <typename... Args>
+inline void ring_buffer<T>::insert_many_back(Args &&...args) {
+  reserve(size_ + sizeof...(args));
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+}  // namespace s21
+
+#endif  // S21_RING_BUFFER_S21_RING_BUFFER_H_
@@ -0,0 +1,116 @@
+#include "s21_ring_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <string>
+
+#include "../s21_queue/s21_queue.h"
+#include "../tests.cpp"
+
+TEST(ring_buffer, wraps_around) {
+  s21::ring_buffer<int> ring;
+  for (int i = 0; i < 8; ++i) ring.push_back(i);
+  EXPECT_EQ(ring.capacity(), 8U);
+  for (int i = 0; i < 5; ++i) ring.pop_front();
+  for (int i = 8; i < 13; ++i) ring.push_back(i);
+  EXPECT_EQ(ring.capacity(), 8U);  // хвост ушел в начало буфера
+  EXPECT_EQ(ring.size(), 8U);
+  for (size_t i = 0; i < ring.size(); ++i) EXPECT_EQ(ring[i], int(i) + 5);
+  ring.push_front(4);
+  EXPECT_EQ(ring.capacity(), 16U);  // рост разворачивает кольцо
+  int expected = 4;
+  for (int value : ring) EXPECT_EQ(value, expected++);
+  EXPECT_EQ(ring.back(), 12);
+}
+
+TEST(ring_buffer, power_of_two_capacity) {
+  s21::ring_buffer<std::string> ring;
+  ring.reserve(100);
+  EXPECT_EQ(ring.capacity(), 128U);
+  ring.reserve(10);
+  EXPECT_EQ(ring.capacity(), 128U);
+  EXPECT_THROW(ring.at(0), std::out_of_range);
+}
+
+TEST(ring_buffer, erase_matches_deque) {
+  s21::ring_buffer<std::string> ring;
+  std::deque<std::string> expected;
+  for (int i = 0; i < 20; ++i) {
+    ring.push_back(std::to_string(i));
+    expected.push_back(std::to_string(i));
+  }
+  for (size_t pos : {3, 15, 0, 16, 8}) {
+    auto it = ring.erase(ring.begin() + pos);
+    auto std_it = expected.erase(expected.begin() + pos);
+    if (std_it != expected.end()) {
+      EXPECT_EQ(*it, *std_it);
+    }
+  }
+  ASSERT_EQ(ring.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) EXPECT_EQ(ring[i], expected[i]);
+}
+
+TEST(ring_buffer, copy_move_clear) {
+  s21::ring_buffer<std::string> a{"a", "b", "c"};
+  a.pop_front();
+  a.push_back("d");
+  a.emplace_front(2, 'z');
+  s21::ring_buffer<std::string> b(a);
+  EXPECT_EQ(b.front(), "zz");
+  EXPECT_EQ(b.back(), "d");
+  s21::ring_buffer<std::string> c(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(c.size(), 4U);
+  size_t capacity = c.capacity();
+  c.clear();
+  EXPECT_TRUE(c.empty());
+  EXPECT_EQ(c.capacity(), capacity);
+  c = b;
+  EXPECT_EQ(c[1], "b");
+  c.push_back(c.front());
+  EXPECT_EQ(c.back(), "zz");
+}
+
+TEST(Queue, drain_large) {
+  s21::queue<int> queue;
+  const int count = 100000;
+  for (int i = 0; i < count; ++i) queue.push(i);
+  for (int i = 0; i < count; ++i) {
+    ASSERT_EQ(queue.front(), i);
+    queue.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+// только перенос, и он бросает, когда заканчивается бюджет
+struct ThrowingMoveOnly {
+  static inline int live = 0;
+  static inline int budget = 1 << 30;
+  int value;
+  explicit ThrowingMoveOnly(int v) : value(v) { ++live; }
+  ThrowingMoveOnly(ThrowingMoveOnly &&other) : value(other.value) {
+    if (budget-- == 0) throw std::runtime_error("move");
+    ++live;
+  }
+  ThrowingMoveOnly &operator=(ThrowingMoveOnly &&) = default;
+  ~ThrowingMoveOnly() { --live; }
+};
+
+TEST(ring_buffer, throwing_move_on_growth_does_not_leak) {
+  ThrowingMoveOnly::live = 0;
+  {
+    s21::ring_buffer<ThrowingMoveOnly> ring;
+    for (int i = 0; i < 8; ++i) ring.emplace_back(i);
+    for (int i = 0; i < 3; ++i) ring.pop_front();
+    for (int i = 8; i < 11; ++i) ring.emplace_back(i);
+    ASSERT_EQ(ring.capacity(), 8U);
+    // первая часть кольца (5 элементов) переносится, вторая бросает
+    ThrowingMoveOnly::budget = 6;
+    EXPECT_THROW(ring.emplace_back(11), std::runtime_error);
+    ThrowingMoveOnly::budget = 1 << 30;
+    EXPECT_EQ(ring.size(), 8U);
+    EXPECT_EQ(ring.capacity(), 8U);
+  }
+  EXPECT_EQ(ThrowingMoveOnly::live, 0);
+}
@@ -0,0 +1,281 @@
+#ifndef S21_SCHEDULER_S21_SCHEDULER_H_
+#define S21_SCHEDULER_S21_SCHEDULER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../s21_lockfree_queue/s21_lockfree_queue.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+
+// Счетчик незавершенных задач. Первое исключение из задач группы
+// сохраняется и пробрасывается из wait(). Группу можно разрушать только
+// после wait() или rethrow_if_failed(): увидеть finished() недостаточно,
+// последний done() еще может держать mutex_.
+class wait_group {
+ public:
+  void add(size_t count = 1);
+  void done();
+  void fail(std::exception_ptr error);
+  bool finished() const;
+  void wait();
+  void rethrow_if_failed();
+
+ private:
+  std::atomic<size_t> pending_{0};
+  std::mutex mutex_;
+  std::condition_variable finished_;
+  std::exception_ptr error_;
+};
+
+// Пул из фиксированного числа потоков с кражей работы. У каждого потока
+// свой work_stealing_deque: задачи, порожденные внутри задачи, кладутся
+// туда и выполняются в LIFO-порядке, а простаивающие потоки воруют
+// старейшие. Задачи из внешних потоков идут через общую mpmc_queue.
+class scheduler {
+ public:
+  explicit scheduler(size_t threads = std::thread::hardware_concurrency());
+  scheduler(const scheduler &) = delete;
+  scheduler &operator=(const scheduler &) = delete;
+  ~scheduler();
+
+  size_t thread_count() const;
+
+  template <typename F>
+  void submit(F &&task);
+  template <typename F>
+  void submit(wait_group &group, F &&task);
+  void wait(wait_group &group);
+
+  // body(i) для каждого i из [first, last). Диапазон делится пополам,
+  // пока куски больше grain (0 - подобрать по числу потоков).
+  template <typename F>
+  void parallel_for(size_t first, size_t last, F &&body, size_t grain = 0);
+
+ private:
+  struct Task {
+    std::function<void()> run;
+    wait_group *group;
+  };
+
+  static constexpr size_t kInjectionCapacity = 1024;
+
+  void enqueue(Task *task);
+  bool run_one();
+  Task *find_task();
+  void execute(Task *task);
+  void worker_loop(size_t index);
+  template <typename F>
+  void split(wait_group &group, size_t first, size_t last, size_t grain,
+             F &body);
+
+  // номер рабочего потока текущего планировщика; чужие потоки - внешние
+  inline static thread_local scheduler *current_ = nullptr;
+  inline static thread_local size_t current_index_ = 0;
+
+  std::vector<std::unique_ptr<work_stealing_deque<Task *>>> deques_;
+  mpmc_queue<Task *> injection_;
+  std::vector<std::thread> threads_;
+  std::atomic<size_t> queued_{0};
+  std::atomic<bool> stopping_{false};
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+};
+
+inline void wait_group::add(size_t count) {
+  pending_.fetch_add(count, std::memory_order_relaxed);
+}
+
+// Пока задач больше одной, счетчик уменьшается без блокировки. Последнее
+// уменьшение и оповещение идут под mutex_: ожидающий берет mutex_ после
+// нуля и не разрушит группу, пока done() к ней обращается.
+inline void wait_group::done() {
+  size_t pending = pending_.load(std::memory_order_relaxed);
+  while (pending > 1) {
+    if (pending_.compare_exchange_weak(pending, pending - 1,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_relaxed)) {
+      return;
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    finished_.notify_all();
+  }
+}
+
+inline void wait_group::fail(std::exception_ptr error) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!error_) error_ = error;
+}
+
+inline bool wait_group::finished() const {
+  return pending_.load(std::memory_order_acquire) == 0;
+}
+
+// Просто ждет, не помогая; из задачи вызывайте scheduler::wait
+inline void wait_group::wait() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    finished_.wait(lock, [this] { return finished(); });
+  }
+  rethrow_if_failed();
+}
+
+inline void wait_group::rethrow_if_failed() {
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::swap(error, error_);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+inline scheduler::scheduler(size_t threads)
+    : injection_(kInjectionCapacity) {
+  threads = std::max<size_t>(threads, 1);
+  for (size_t i = 0; i < threads; ++i) {
+    deques_.emplace_back(new work_stealing_deque<Task *>());
+  }
+  for (size_t i = 0; i < threads; ++i) {
+    threads_.emplace_back(&scheduler::worker_loop, this, i);
+  }
+}
+
+// Дожидается выполнения всех отправленных задач
+inline scheduler::~scheduler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_.store(true, std::memory_order_release);
+  }
+  work_available_.notify_all();
+  for (auto &thread : threads_) thread.join();
+}
+
+inline size_t scheduler::thread_count() const { return threads_.size(); }
+
+template <typename F>
+inline void scheduler::submit(F &&task) {
+  enqueue(new Task{std::function<void()>(std::forward<F>(task)), nullptr});
+}
+
+template <typename F>
+inline void scheduler::submit(wait_group &group, F &&task) {
+  group.add();
+  enqueue(new Task{std::function<void()>(std::forward<F>(task)), &group});
+}
+
+// Ожидающий поток сам выполняет задачи, поэтому ждать можно и из задачи.
+// rethrow_if_failed берет mutex_ группы и так дожидается последнего done()
+inline void scheduler::wait(wait_group &group) {
+  while (!group.finished()) {
+    if (!run_one()) std::this_thread::yield();
+  }
+  group.rethrow_if_failed();
+}
+
+template <typename F>
+inline void scheduler::parallel_for(size_t first, size_t last, F &&body,
+                                    size_t grain) {
+  if (first >= last) return;
+  if (grain == 0) {
+    grain = std::max<size_t>(1, (last - first) / (thread_count() * 8));
+  }
+  wait_group group;
+  try {
+    split(group, first, last, grain, body);
+  } catch (...) {
+    group.fail(std::current_exception());
+  }
+  wait(group);
+}
+
+// Правая половина уходит в дек, левая обрабатывается на месте
+template <typename F>
+inline void scheduler::split(wait_group &group, size_t first, size_t last,
+                             size_t grain, F &body) {
+  while (last - first > grain) {
+    size_t middle = first + (last - first) / 2;
+    submit(group, [this, &group, middle, last, grain, &body] {
+      split(group, middle, last, grain, body);
+    });
+    last = middle;
+  }
+  for (size_t i = first; i < last; ++i) body(i);
+}
+
+inline void scheduler::enqueue(Task *task) {
+  queued_.fetch_add(1, std::memory_order_release);
+  if (current_ == this) {
+    deques_[current_index_]->push(task);
+  } else {
+    // очередь переполнена - помогаем разгрести ее
+    while (!injection_.try_push(task)) {
+      if (!run_one()) std::this_thread::yield();
+    }
+  }
+  { std::lock_guard<std::mutex> lock(mutex_); }
+  work_available_.notify_one();
+}
+
+inline scheduler::Task *scheduler::find_task() {
+  Task *task = nullptr;
+  size_t own = current_ == this ? current_index_ : deques_.size();
+  if (own < deques_.size() && deques_[own]->pop(task)) return task;
+  if (injection_.try_pop(task)) return task;
+  for (size_t i = 1; i <= deques_.size(); ++i) {
+    size_t victim = (own + i) % deques_.size();
+    if (victim != own && deques_[victim]->steal(task)) return task;
+  }
+  return nullptr;
+}
+
+inline bool scheduler::run_one() {
+  Task *task = find_task();
+  if (!task) return false;
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  execute(task);
+  return true;
+}
+
+// Исключение без группы некому передать - как у std::thread
+inline void scheduler::execute(Task *task) {
+  std::unique_ptr<Task> owned(task);
+  try {
+    owned->run();
+  } catch (...) {
+    if (!owned->group) std::terminate();
+    owned->group->fail(std::current_exception());
+  }
+  if (owned->group) owned->group->done();
+}
+
+inline void scheduler::worker_loop(size_t index) {
+  current_ = this;
+  current_index_ = index;
+  for (;;) {
+    if (run_one()) continue;
+    std::unique_lock<std::mutex> lock(mutex_);
+    work_available_.wait(lock, [this] {
+      return queued_.load(std::memory_order_acquire) > 0 ||
+             stopping_.load(std::memory_order_acquire);
+    });
+    if (stopping_.load(std::memory_order_acquire) &&
+        queued_.load(std::memory_order_acquire) == 0) {
+      break;
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_SCHEDULER_S21_SCHEDULER_H_
@@ -0,0 +1,116 @@
+#include "s21_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../tests.cpp"
+#include "s21_work_stealing_deque.h"
+
+TEST(work_stealing_deque, owner_lifo_thief_fifo) {
+  s21::work_stealing_deque<int> deque(2);
+  for (int i = 0; i < 10; ++i) deque.push(i);  // дважды растет
+  EXPECT_EQ(deque.size_approx(), 10U);
+  int value = -1;
+  EXPECT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 9);
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 0);
+  while (deque.pop(value)) {
+  }
+  EXPECT_EQ(value, 1);
+  EXPECT_FALSE(deque.steal(value));
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(work_stealing_deque, each_item_taken_once) {
+  const int count = 100000, thieves = 3;
+  s21::work_stealing_deque<int> deque;
+  std::vector<std::atomic<int>> taken(count);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thieves; ++t) {
+    threads.emplace_back([&] {
+      int value;
+      while (!done.load() || !deque.empty()) {
+        if (deque.steal(value)) taken[value].fetch_add(1);
+      }
+    });
+  }
+  int value;
+  for (int i = 0; i < count; ++i) {
+    deque.push(i);
+    if (i % 3 == 0 && deque.pop(value)) taken[value].fetch_add(1);
+  }
+  while (deque.pop(value)) taken[value].fetch_add(1);
+  done.store(true);
+  for (auto &thread : threads) thread.join();
+  int wrong = 0;
+  for (auto &counter : taken) wrong += counter.load() != 1;
+  EXPECT_EQ(wrong, 0);
+}
+
+TEST(scheduler, parallel_for_covers_range) {
+  s21::scheduler pool(4);
+  EXPECT_EQ(pool.thread_count(), 4U);
+  std::vector<int> hits(10000, 0);
+  pool.parallel_for(0, hits.size(), [&](size_t i) { hits[i] += int(i % 7); });
+  long sum = 0;
+  for (size_t i = 0; i < hits.size(); ++i) {
+    EXPECT_EQ(hits[i], int(i % 7));
+    sum += hits[i];
+  }
+  EXPECT_GT(sum, 0);
+  pool.parallel_for(5, 5, [](size_t) { FAIL(); });
+}
+
+TEST(scheduler, nested_tasks_and_wait_group) {
+  s21::scheduler pool(3);
+  std::atomic<long> total{0};
+  s21::wait_group group;
+  for (int outer = 0; outer < 8; ++outer) {
+    pool.submit(group, [&pool, &total] {
+      pool.parallel_for(0, 100, [&total](size_t i) { total += long(i); },
+                        10);
+    });
+  }
+  pool.wait(group);
+  EXPECT_EQ(total.load(), 8 * 4950);
+  s21::wait_group plain;
+  std::atomic<int> runs{0};
+  for (int i = 0; i < 50; ++i) pool.submit(plain, [&runs] { ++runs; });
+  plain.wait();
+  EXPECT_EQ(runs.load(), 50);
+}
+
+TEST(scheduler, exception_reaches_waiter) {
+  s21::scheduler pool(2);
+  EXPECT_THROW(pool.parallel_for(0, 1000,
+                                 [](size_t i) {
+                                   if (i == 777) throw std::runtime_error("x");
+                                 }),
+               std::runtime_error);
+  std::atomic<int> runs{0};
+  {
+    s21::scheduler short_lived(2);
+    for (int i = 0; i < 100; ++i) short_lived.submit([&runs] { ++runs; });
+  }
+  EXPECT_EQ(runs.load(), 100);
+}
+
+TEST(scheduler, short_lived_groups) {
+  // группа на стеке разрушается сразу после ожидания, пока рабочий поток
+  // мог еще завершать done() последней задачи
+  s21::scheduler pool(3);
+  std::atomic<int> runs{0};
+  for (int round = 0; round < 2000; ++round) {
+    pool.parallel_for(0, 4, [&runs](size_t) { ++runs; }, 1);
+    s21::wait_group group;
+    pool.submit(group, [&runs] { ++runs; });
+    group.wait();
+  }
+  EXPECT_EQ(runs.load(), 2000 * 5);
+}
@@ -0,0 +1,153 @@
+#ifndef S21_SCHEDULER_S21_WORK_STEALING_DEQUE_H_
+#define S21_SCHEDULER_S21_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_lockfree_queue/s21_lockfree_queue.h"
+
+namespace s21 {
+
+// Дек Чейза-Лева для кражи работы. Владелец кладет и забирает с нижнего
+// конца (LIFO, без CAS, кроме борьбы за последний элемент), остальные
+// потоки воруют с верхнего (FIFO) через CAS на top_. Кольцо растет
+// вдвое; старые массивы живут до разрушения дека, так как вор может еще
+// читать из них.
+template <typename T>
+class work_stealing_deque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "work_stealing_deque stores values in atomics");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  explicit work_stealing_deque(size_type capacity = 64);
+  work_stealing_deque(const work_stealing_deque &) = delete;
+  work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+  ~work_stealing_deque();
+
+  void push(value_type value);
+  bool pop(value_type &value);
+  bool steal(value_type &value);
+
+  size_type size_approx() const;
+  bool empty() const;
+
+ private:
+  struct Ring {
+    explicit Ring(size_type capacity)
+        : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+    T get(std::ptrdiff_t i) const {
+      return slots[i & mask].load(std::memory_order_relaxed);
+    }
+    void put(std::ptrdiff_t i, T value) {
+      slots[i & mask].store(value, std::memory_order_relaxed);
+    }
+    size_type mask;
+    std::unique_ptr<std::atomic<T>[]> slots;
+  };
+
+  Ring *grow(Ring *ring, std::ptrdiff_t bottom, std::ptrdiff_t top);
+
+  alignas(kCacheLine) std::atomic<std::ptrdiff_t> top_{0};
+  alignas(kCacheLine) std::atomic<std::ptrdiff_t> bottom_{0};
+  std::atomic<Ring *> ring_;
+  std::vector<std::unique_ptr<Ring>> rings_;  // текущее и прежние кольца
+};
+
+template <typename T>
+inline work_stealing_deque<T>::work_stealing_deque(size_type capacity) {
+  rings_.emplace_back(new Ring(lockfree_capacity(capacity)));
+  ring_.store(rings_.back().get(), std::memory_order_relaxed);
+}
+
+template <typename T>
+inline work_stealing_deque<T>::~work_stealing_deque() = default;
+
+// Только владелец
+template <typename T>
+inline void work_stealing_deque<T>::push(value_type value) {
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+  std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+  Ring *ring = ring_.load(std::memory_order_relaxed);
+  if (static_cast<size_type>(bottom - top) > ring->mask) {
+    ring = grow(ring, bottom, top);
+  }
+  ring->put(bottom, value);
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+// Только владелец. Сначала резервируем элемент уменьшением bottom_, затем
+// смотрим top_; за последний элемент спорим с ворами через CAS. Пара
+// seq_cst запись-чтение здесь и чтение-чтение в steal заменяет барьеры
+// из оригинального алгоритма.
+template <typename T>
+inline bool work_stealing_deque<T>::pop(value_type &value) {
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Ring *ring = ring_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  std::ptrdiff_t top = top_.load(std::memory_order_seq_cst);
+  bool taken = false;
+  if (top <= bottom) {
+    value = ring->get(bottom);
+    taken = true;
+    if (top == bottom) {
+      taken = top_.compare_exchange_strong(top, top + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+  } else {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return taken;
+}
+
+// Любой поток. false, если дек пуст или элемент перехватили.
+template <typename T>
+inline bool work_stealing_deque<T>::steal(value_type &value) {
+  std::ptrdiff_t top = top_.load(std::memory_order_seq_cst);
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return false;
+  Ring *ring = ring_.load(std::memory_order_acquire);
+  T candidate = ring->get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return false;
+  }
+  value = candidate;
+  return true;
+}
+
+template <typename T>
+inline typename work_stealing_deque<T>::size_type
+work_stealing_deque<T>::size_approx() const {
+  std::ptrdiff_t top = top_.load(std::memory_order_relaxed);
+  std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+}
+
+template <typename T>
+inline bool work_stealing_deque<T>::empty() const {
+  return size_approx() == 0;
+}
+
+// Только владелец: копирует живые элементы [top, bottom) в кольцо вдвое
+// больше и публикует его
+template <typename T>
+inline typename work_stealing_deque<T>::Ring *work_stealing_deque<T>::grow(
+    Ring *ring, std::ptrdiff_t bottom, std::ptrdiff_t top) {
+  rings_.emplace_back(new Ring((ring->mask + 1) * 2));
+  Ring *bigger = rings_.back().get();
+  for (std::ptrdiff_t i = top; i < bottom; ++i) bigger->put(i, ring->get(i));
+  ring_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+
+}  // namespace s21
+
+#endif  // S21_SCHEDULER_S21_WORK_STEALING_DEQUE_H_
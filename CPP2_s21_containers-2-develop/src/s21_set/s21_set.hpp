@@ -5,7 +5,8 @@
 #include "../s21_vector/s21_vector.h"
 
 namespace s21 {
-template <typename Key>
+template <typename Key, typename Compare = std::less<>,
+          typename Allocator = std::allocator<Key>>
 class set {
  public:
   class Set_Iterator;
@@ -14,18 +15,25 @@ class set {
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = set<Key>::Set_Iterator;
+  using iterator = set<Key, Compare, Allocator>::Set_Iterator;
   using const_iterator = Const_Set_Iterator;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
 
  private:
-  Tree<key_type, value_type> _tree;
+  using tree_type = Tree<key_type, value_type, Compare, Allocator>;
+  tree_type _tree;
+  static const Key& key_of(const value_type& value) { return value; }
 
  public:
   set();
+  explicit set(const Compare& comp);
   set(std::initializer_list<value_type> const& items);
+  template <typename ForwardIt>
+  set(ForwardIt first, ForwardIt last);
   set(const set& other);
-  set(set&& other);
+  set(set&& other) noexcept;
   ~set();
 
   set& operator=(const set& s);
@@ -37,32 +45,66 @@ class set {
   const_iterator cend() const;
 
   template <typename... Args>
-  vector<std::pair<typename set<Key>::iterator, bool>> insert_many(
-      Args&&... args);
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
   bool empty();
   size_type size();
   size_type max_size();
+  key_compare key_comp() const;
 
   void clear();
 
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  // вставка перед hint: при верной подсказке без спуска от корня
+  iterator insert(iterator hint, const value_type& value);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
   void erase(iterator pos);
-  void swap(set& other);
+  void swap(set& other) noexcept;
   void merge(set& other);
 
   iterator find(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key);
   bool contains(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key);
+
+  iterator nth_element(size_type k);  // k-й по порядку элемент или end()
+  size_type rank(const Key& key);     // число ключей меньше key
+  size_type count_range(const Key& from, const Key& to);  // ключи из [from, to)
+  size_type count(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K& key);
+  iterator lower_bound(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K& key);
+  iterator upper_bound(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K& key);
+  std::pair<iterator, iterator> equal_range(const Key& key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key);
 
   class Set_Iterator {
    public:
-    using iterator = set<Key>::Set_Iterator;
-    using tree_iterator = typename Tree<key_type, value_type>::Iterator;
+    using iterator = set<Key, Compare, Allocator>::Set_Iterator;
+    using tree_iterator = typename tree_type::Iterator;
     using const_tree_iterator =
-        typename Tree<key_type, value_type>::Const_Iterator;
+        typename tree_type::Const_Iterator;
     Set_Iterator() = default;
     Set_Iterator(tree_iterator it);
     Set_Iterator(const_tree_iterator it);
+    Set_Iterator(const Set_Iterator& other) = default;
     ~Set_Iterator() = default;
 
     Set_Iterator& operator++();
@@ -80,15 +122,15 @@ class set {
 
    private:
     tree_iterator it;
-    friend void set<Key>::erase(iterator pos);
+    friend class set<Key, Compare, Allocator>;
   };
 
   class Const_Set_Iterator {
    public:
-    using tree_iterator = typename Tree<key_type, value_type>::Iterator;
+    using tree_iterator = typename tree_type::Iterator;
     using const_iterator = Const_Set_Iterator;
     using const_tree_iterator =
-        typename Tree<key_type, value_type>::Const_Iterator;
+        typename tree_type::Const_Iterator;
     Const_Set_Iterator() = default;
     Const_Set_Iterator(tree_iterator it);
     Const_Set_Iterator(const_tree_iterator it);
@@ -110,36 +152,41 @@ class set {
   };
 };
 
-template <typename Key>
-set<Key>::set() : _tree() {}
+template <typename Key, typename Compare, typename Allocator>
+set<Key, Compare, Allocator>::set() : _tree() {}
 
-template <typename Key>
-set<Key>::set(std::initializer_list<value_type> const& items) {
-  _tree = Tree<key_type, value_type>();
-  for (const value_type& item : items) {
-    if (!contains(item)) insert(item);
-  }
-  // _tree = Tree<key_type, value_type>(items);
-}
+template <typename Key, typename Compare, typename Allocator>
+set<Key, Compare, Allocator>::set(const Compare& comp) : _tree(comp) {}
 
-template <typename Key>
-set<Key>::set(const set& other) {
-  _tree = Tree<key_type, value_type>(other._tree);
+template <typename Key, typename Compare, typename Allocator>
+set<Key, Compare, Allocator>::set(
+    std::initializer_list<value_type> const& items) {
+  _tree.assign_range(items.begin(), items.end(), key_of, true);
 }
 
-template <typename Key>
-set<Key>::set(set&& other) {
-  _tree = std::move(other._tree);
+// упорядоченный диапазон без повторов строится за O(n)
+template <typename Key, typename Compare, typename Allocator>
+template <typename ForwardIt>
+set<Key, Compare, Allocator>::set(ForwardIt first, ForwardIt last) {
+  _tree.assign_range(first, last, key_of, true);
 }
 
-template <typename Key>
-set<Key>::~set() {
+template <typename Key, typename Compare, typename Allocator>
+set<Key, Compare, Allocator>::set(const set& other) : _tree(other._tree) {}
+
+template <typename Key, typename Compare, typename Allocator>
+set<Key, Compare, Allocator>::set(set&& other) noexcept
+    : _tree(std::move(other._tree)) {}
+
+template <typename Key, typename Compare, typename Allocator>
+set<Key, Compare, Allocator>::~set() {
   // std::cout  <<  "Set destructor!" << std::endl;
   _tree.clean();
 }
 
-template <typename Key>
-set<Key>& set<Key>::operator=(const set& s) {
+template <typename Key, typename Compare, typename Allocator>
+set<Key, Compare, Allocator>& set<Key, Compare, Allocator>::operator=(
+    const set& s) {
   if (this == &s) {
     return *this;
   }
@@ -147,8 +194,9 @@ set<Key>& set<Key>::operator=(const set& s) {
   return *this;
 }
 
-template <typename Key>
-set<Key>& set<Key>::operator=(set&& s) noexcept {
+template <typename Key, typename Compare, typename Allocator>
+set<Key, Compare, Allocator>& set<Key, Compare, Allocator>::operator=(
+    set&& s) noexcept {
   if (this == &s) {
     return *this;
   }
@@ -156,35 +204,42 @@ set<Key>& set<Key>::operator=(set&& s) noexcept {
   return *this;
 }
 
-template <typename Key>
-inline bool s21::set<Key>::empty() {
+template <typename Key, typename Compare, typename Allocator>
+inline bool s21::set<Key, Compare, Allocator>::empty() {
   return _tree.empty();
 }
 
-template <typename Key>
-typename set<Key>::size_type set<Key>::size() {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::size_type
+set<Key, Compare, Allocator>::size() {
   return _tree.size();
 }
 
-template <typename Key>
-typename set<Key>::size_type set<Key>::max_size() {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::size_type
+set<Key, Compare, Allocator>::max_size() {
   return _tree.max_size();
 }
 
-template <typename Key>
-void set<Key>::clear() {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::key_compare
+set<Key, Compare, Allocator>::key_comp() const {
+  return _tree.key_comp();
+}
+
+template <typename Key, typename Compare, typename Allocator>
+void set<Key, Compare, Allocator>::clear() {
   _tree.clean();
-  // _tree = Tree<key_type, value_type>();
+  // _tree = tree_type();
 }
 
-template <typename Key>
-void set<Key>::swap(set& other) {
-  if (this == &other) throw std::invalid_argument("swap");
+template <typename Key, typename Compare, typename Allocator>
+void set<Key, Compare, Allocator>::swap(set& other) noexcept {
   _tree.swap(other._tree);
 }
 
-template <typename Key>
-void set<Key>::merge(set& other) {
+template <typename Key, typename Compare, typename Allocator>
+void set<Key, Compare, Allocator>::merge(set& other) {
   // _tree.merge(other._tree);
   if (this == &other) throw std::invalid_argument("merge");
   for (auto it = other.begin(); it != other.end(); ++it) {
@@ -192,64 +247,153 @@ void set<Key>::merge(set& other) {
   }
 }
 
-template <typename Key>
-void set<Key>::erase(iterator pos) {
+template <typename Key, typename Compare, typename Allocator>
+void set<Key, Compare, Allocator>::erase(iterator pos) {
   _tree.erase(pos.it);
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::find(const Key& key) {
-  auto node = _tree.find(key);
-  if (node == nullptr) return end();
-  auto iter = _tree.begin();
-  auto it_end = _tree.end();
-  while (iter != it_end) {
-    if (iter.get_node()->key == key) break;
-    ++iter;
-  }
-  return iterator(iter);
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::find(const Key& key) {
+  return iterator(_tree.find_iterator(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::find(const K& key) {
+  return iterator(_tree.find_iterator(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+bool set<Key, Compare, Allocator>::contains(const Key& key) {
+  return _tree.contains(key);
 }
 
-template <typename Key>
-bool set<Key>::contains(const Key& key) {
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+bool set<Key, Compare, Allocator>::contains(const K& key) {
   return _tree.contains(key);
 }
 
-template <typename Key>
-inline set<Key>::Set_Iterator::Set_Iterator(tree_iterator it) : it(it) {}
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::nth_element(size_type k) {
+  return iterator(_tree.nth_element(k));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::size_type
+set<Key, Compare, Allocator>::rank(const Key& key) {
+  return _tree.rank(key);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::size_type
+set<Key, Compare, Allocator>::count_range(const Key& from, const Key& to) {
+  return _tree.count_range(from, to);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::size_type
+set<Key, Compare, Allocator>::count(const Key& key) {
+  return _tree.count(key);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename set<Key, Compare, Allocator>::size_type
+set<Key, Compare, Allocator>::count(const K& key) {
+  return _tree.count(key);
+}
+
+// первый элемент с ключом не меньше key, за O(log n)
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::lower_bound(const Key& key) {
+  return iterator(_tree.lower_bound(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::lower_bound(const K& key) {
+  return iterator(_tree.lower_bound(key));
+}
+
+// первый элемент с ключом больше key, за O(log n)
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::upper_bound(const Key& key) {
+  return iterator(_tree.upper_bound(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::upper_bound(const K& key) {
+  return iterator(_tree.upper_bound(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+std::pair<typename set<Key, Compare, Allocator>::iterator,
+          typename set<Key, Compare, Allocator>::iterator>
+set<Key, Compare, Allocator>::equal_range(const Key& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename K, typename C, typename>
+std::pair<typename set<Key, Compare, Allocator>::iterator,
+          typename set<Key, Compare, Allocator>::iterator>
+set<Key, Compare, Allocator>::equal_range(const K& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+inline set<Key, Compare, Allocator>::Set_Iterator::Set_Iterator(
+    tree_iterator it)
+    : it(it) {}
 
 //
 //
 //
 //
 
-template <typename Key>
-inline set<Key>::Set_Iterator::Set_Iterator(const_tree_iterator it) : it(it) {}
+template <typename Key, typename Compare, typename Allocator>
+inline set<Key, Compare, Allocator>::Set_Iterator::Set_Iterator(
+    const_tree_iterator it)
+    : it(it) {}
 
-template <typename Key>
-typename set<Key>::Set_Iterator& set<Key>::Set_Iterator::operator++() {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::Set_Iterator&
+set<Key, Compare, Allocator>::Set_Iterator::operator++() {
   ++it;
   return *this;
 }
 
-template <typename Key>
-typename set<Key>::Set_Iterator& set<Key>::Set_Iterator::operator--() {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::Set_Iterator&
+set<Key, Compare, Allocator>::Set_Iterator::operator--() {
   --it;
   return *this;
 }
 
-template <typename Key>
-typename set<Key>::Set_Iterator set<Key>::Set_Iterator::operator++(int) {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::Set_Iterator
+set<Key, Compare, Allocator>::Set_Iterator::operator++(int) {
   return it++;
 }
 
-template <typename Key>
-typename set<Key>::Set_Iterator set<Key>::Set_Iterator::operator--(int) {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::Set_Iterator
+set<Key, Compare, Allocator>::Set_Iterator::operator--(int) {
   return it--;
 }
 
-template <typename Key>
-typename set<Key>::Set_Iterator& set<Key>::Set_Iterator::operator=(
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::Set_Iterator&
+set<Key, Compare, Allocator>::Set_Iterator::operator=(
     const Set_Iterator& other) {
   if (this != &other) {
     it = other.it;
@@ -257,57 +401,75 @@ typename set<Key>::Set_Iterator& set<Key>::Set_Iterator::operator=(
   return *this;
 }
 
-template <typename Key>
-bool set<Key>::Set_Iterator::operator==(const iterator& other) const {
+template <typename Key, typename Compare, typename Allocator>
+bool set<Key, Compare, Allocator>::Set_Iterator::operator==(
+    const iterator& other) const {
   return it == other.it;
 }
 
-template <typename Key>
-inline bool set<Key>::Set_Iterator::operator!=(const iterator& other) const {
+template <typename Key, typename Compare, typename Allocator>
+inline bool set<Key, Compare, Allocator>::Set_Iterator::operator!=(
+    const iterator& other) const {
   return it != other.it;
 }
 
-template <typename Key>
-typename set<Key>::const_reference set<Key>::Set_Iterator::operator*() const {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::const_reference
+set<Key, Compare, Allocator>::Set_Iterator::operator*() const {
   if (it.get_node() == nullptr)
     throw std::out_of_range("Set_Iterator::operator*()");
   return *it;
 }
 
-template <typename Key>
-const typename set<Key>::value_type* set<Key>::Set_Iterator::operator->()
-    const {
+template <typename Key, typename Compare, typename Allocator>
+const typename set<Key, Compare, Allocator>::value_type*
+set<Key, Compare, Allocator>::Set_Iterator::operator->() const {
   return &(it->value);
 }
 
-template <typename Key>
-typename std::pair<typename set<Key>::iterator, bool> set<Key>::insert(
-    const value_type& value) {
-  if (contains(value)) {
-    auto it = find(value);
-    return std::make_pair(it, false);
-  }
+template <typename Key, typename Compare, typename Allocator>
+typename std::pair<typename set<Key, Compare, Allocator>::iterator, bool>
+set<Key, Compare, Allocator>::insert(const value_type& value) {
   auto res = _tree.insert(value, value);
   return std::make_pair(iterator(res.first), res.second);
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::begin() {
+template <typename Key, typename Compare, typename Allocator>
+typename std::pair<typename set<Key, Compare, Allocator>::iterator, bool>
+set<Key, Compare, Allocator>::insert(value_type&& value) {
+  auto res = _tree.emplace_unique(std::move(value));
+  return std::make_pair(iterator(res.first), res.second);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename... Args>
+typename std::pair<typename set<Key, Compare, Allocator>::iterator, bool>
+set<Key, Compare, Allocator>::emplace(Args&&... args) {
+  auto res = _tree.emplace_unique(std::forward<Args>(args)...);
+  return std::make_pair(iterator(res.first), res.second);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::begin() {
   return iterator(_tree.begin());
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::end() {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::end() {
   return iterator(_tree.end());
 }
 
-template <typename Key>
-typename set<Key>::const_iterator set<Key>::cbegin() const {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::const_iterator
+set<Key, Compare, Allocator>::cbegin() const {
   return const_iterator(_tree.cbegin());
 }
 
-template <typename Key>
-typename set<Key>::const_iterator set<Key>::cend() const {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::const_iterator
+set<Key, Compare, Allocator>::cend() const {
   return const_iterator(_tree.cend());
 }
 
@@ -317,71 +479,73 @@ typename set<Key>::const_iterator set<Key>::cend() const {
 //
 //
 
-template <typename Key>
-inline set<Key>::Const_Set_Iterator::Const_Set_Iterator(tree_iterator it)
+template <typename Key, typename Compare, typename Allocator>
+inline set<Key, Compare, Allocator>::Const_Set_Iterator::Const_Set_Iterator(
+    tree_iterator it)
     : it(it) {}
 
-template <typename Key>
-inline set<Key>::Const_Set_Iterator::Const_Set_Iterator(const_tree_iterator it)
+template <typename Key, typename Compare, typename Allocator>
+inline set<Key, Compare, Allocator>::Const_Set_Iterator::Const_Set_Iterator(
+    const_tree_iterator it)
     : it(it){};
 
-template <typename Key>
-typename set<Key>::Const_Set_Iterator&
-set<Key>::Const_Set_Iterator::operator++() {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::Const_Set_Iterator&
+set<Key, Compare, Allocator>::Const_Set_Iterator::operator++() {
   ++it;
   return *this;
 }
 
-template <typename Key>
-typename set<Key>::Const_Set_Iterator&
-set<Key>::Const_Set_Iterator::operator--() {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::Const_Set_Iterator&
+set<Key, Compare, Allocator>::Const_Set_Iterator::operator--() {
   --it;
   return *this;
 }
 
-template <typename Key>
-typename set<Key>::Const_Set_Iterator set<Key>::Const_Set_Iterator::operator++(
-    int) {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::Const_Set_Iterator
+set<Key, Compare, Allocator>::Const_Set_Iterator::operator++(int) {
   return it++;
 }
 
-template <typename Key>
-typename set<Key>::Const_Set_Iterator set<Key>::Const_Set_Iterator::operator--(
-    int) {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::Const_Set_Iterator
+set<Key, Compare, Allocator>::Const_Set_Iterator::operator--(int) {
   return it--;
 }
 
-template <typename Key>
-bool set<Key>::Const_Set_Iterator::operator==(
+template <typename Key, typename Compare, typename Allocator>
+bool set<Key, Compare, Allocator>::Const_Set_Iterator::operator==(
     const const_iterator& other) const {
   return it == other.it;
 }
 
-template <typename Key>
-inline bool set<Key>::Const_Set_Iterator::operator!=(
+template <typename Key, typename Compare, typename Allocator>
+inline bool set<Key, Compare, Allocator>::Const_Set_Iterator::operator!=(
     const const_iterator& other) const {
   return it != other.it;
 }
 
-template <typename Key>
-typename set<Key>::const_reference set<Key>::Const_Set_Iterator::operator*()
-    const {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::const_reference
+set<Key, Compare, Allocator>::Const_Set_Iterator::operator*() const {
   if (it.get_node() == nullptr)
     throw std::out_of_range("Const_Set_Iterator::operator*()");
   return *it;
 }
 
-template <typename Key>
-typename set<Key>::value_type* set<Key>::Const_Set_Iterator::operator->()
-    const {
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::value_type*
+set<Key, Compare, Allocator>::Const_Set_Iterator::operator->() const {
   return &(it->value);
 }
 
-template <typename Key>
+template <typename Key, typename Compare, typename Allocator>
 template <typename... Args>
-vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
-    Args&&... args) {
-  vector<std::pair<typename set<Key>::iterator, bool>> result_vector;
+vector<std::pair<typename set<Key, Compare, Allocator>::iterator, bool>>
+set<Key, Compare, Allocator>::insert_many(Args&&... args) {
+  vector<std::pair<iterator, bool>> result_vector;
   result_vector.reserve(sizeof...(args));
 
   auto args_tuple = std::make_tuple(std::forward<Args>(args)...);
@@ -399,4 +563,18 @@ vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
   return result_vector;
 }
 
+template <typename Key, typename Compare, typename Allocator>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::insert(iterator hint, const value_type& value) {
+  return emplace_hint(hint, value);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename... Args>
+typename set<Key, Compare, Allocator>::iterator
+set<Key, Compare, Allocator>::emplace_hint(iterator hint, Args&&... args) {
+  auto res = _tree.emplace_hint_unique(hint.it, std::forward<Args>(args)...);
+  return iterator(res.first);
+}
+
 }  // namespace s21
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <set>
+#include <string>
 
 #include "../tests.cpp"
 using namespace s21;
@@ -125,3 +126,146 @@ TEST(s21_set, swap_1) {
   test_eq<int>(a, std_a);
   test_eq<int>(b, std_b);
 }
+
+TEST(s21_set, order_statistics) {
+  set<int> a;
+  std::set<int> std_a;
+  for (int i = 0; i < 1000; ++i) {
+    int key = (i * 37) % 1009;
+    a.insert(key);
+    std_a.insert(key);
+  }
+  EXPECT_EQ(a.size(), std_a.size());
+  std::size_t k = 0;
+  for (auto it = std_a.begin(); it != std_a.end(); ++it, ++k) {
+    EXPECT_EQ(*a.nth_element(k), *it);
+    EXPECT_EQ(a.rank(*it), k);
+  }
+  EXPECT_TRUE(a.nth_element(std_a.size()) == a.end());
+  EXPECT_EQ(a.count_range(100, 200),
+            static_cast<std::size_t>(std::distance(std_a.lower_bound(100),
+                                                   std_a.lower_bound(200))));
+  EXPECT_EQ(a.count_range(200, 100), 0u);
+  a.erase(a.find(*a.nth_element(10)));
+  EXPECT_EQ(a.size(), std_a.size() - 1);
+  EXPECT_EQ(a.rank(2000), a.size());
+}
+
+// аллокатор, считающий обращения к нему
+static int pool_alloc_calls = 0;
+static int pool_alloc_live = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+  T *allocate(std::size_t n) {
+    ++pool_alloc_calls;
+    ++pool_alloc_live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) {
+    --pool_alloc_live;
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const CountingAllocator &) const { return true; }
+  bool operator!=(const CountingAllocator &) const { return false; }
+};
+
+TEST(s21_set, node_pool) {
+  pool_alloc_calls = 0;
+  pool_alloc_live = 0;
+  {
+    set<int, std::less<>, CountingAllocator<int>> a;
+    for (int i = 0; i < 1000; ++i) a.insert(i);
+    EXPECT_EQ(a.size(), 1000u);
+    int calls = pool_alloc_calls;
+    EXPECT_LT(calls, 100);  // узлы берутся блоками, а не по одному
+    for (int i = 0; i < 500; ++i) a.erase(a.find(i));
+    for (int i = 0; i < 500; ++i) a.insert(i + 1000);
+    EXPECT_EQ(pool_alloc_calls, calls);  // освобождённые узлы переиспользуются
+    EXPECT_EQ(*a.begin(), 500);
+    a.clear();
+    EXPECT_EQ(pool_alloc_live, 0);
+    EXPECT_TRUE(a.empty());
+    a.insert(7);
+    EXPECT_EQ(*a.find(7), 7);
+  }
+  EXPECT_EQ(pool_alloc_live, 0);
+}
+
+TEST(s21_set, bounds_and_count) {
+  set<int> a({10, 20, 30, 40});
+  EXPECT_EQ(*a.lower_bound(20), 20);
+  EXPECT_EQ(*a.lower_bound(21), 30);
+  EXPECT_EQ(*a.upper_bound(20), 30);
+  EXPECT_TRUE(a.upper_bound(40) == a.end());
+  EXPECT_EQ(a.count(30), 1u);
+  EXPECT_EQ(a.count(31), 0u);
+  auto range = a.equal_range(25);
+  EXPECT_TRUE(range.first == range.second);
+  EXPECT_EQ(*range.first, 30);
+}
+
+TEST(s21_set, emplace) {
+  set<std::string> b;
+  EXPECT_TRUE(b.emplace(3, 'a').second);
+  EXPECT_FALSE(b.insert(std::string("aaa")).second);
+  std::string key("bbb");
+  EXPECT_TRUE(b.insert(std::move(key)).second);
+  EXPECT_EQ(b.size(), 2u);
+  EXPECT_EQ(*b.find("bbb"), "bbb");
+}
+
+TEST(s21_set, hinted_insert) {
+  set<int> a;
+  for (int i = 0; i < 1000; ++i) a.insert(a.end(), i * 2);
+  EXPECT_EQ(a.size(), 1000u);
+  auto it = a.insert(a.find(10), 9);
+  EXPECT_EQ(*it, 9);
+  EXPECT_EQ(*++it, 10);
+  it = a.insert(a.begin(), 500);  // повтор: вернётся имеющийся элемент
+  EXPECT_EQ(*it, 500);
+  EXPECT_EQ(a.size(), 1001u);
+  EXPECT_EQ(a.rank(500), 251u);
+}
+
+TEST(s21_set, custom_compare) {
+  set<int, std::greater<int>> a({1, 5, 3, 4});
+  EXPECT_EQ(*a.begin(), 5);
+  EXPECT_EQ(*a.lower_bound(2), 1);  // первый не "меньше" 2 в обратном порядке
+  EXPECT_EQ(a.rank(3), 2u);
+  EXPECT_TRUE(a.key_comp()(2, 1));
+  multiset<std::string, std::greater<>> b({"a", "c", "b", "c"});
+  EXPECT_EQ(*b.begin(), "c");
+  EXPECT_EQ(b.count("c"), 2u);
+}
+
+// id без std::string: сравнение строки с числом через прозрачный компаратор
+struct NameById {
+  using is_transparent = void;
+  bool operator()(const std::string& a, const std::string& b) const {
+    return a < b;
+  }
+  bool operator()(const std::string& a, int b) const {
+    return a < std::to_string(b);
+  }
+  bool operator()(int a, const std::string& b) const {
+    return std::to_string(a) < b;
+  }
+};
+
+TEST(s21_set, transparent_lookup) {
+  set<std::string, NameById> a({"1", "2", "30"});
+  EXPECT_TRUE(a.contains(30));
+  EXPECT_FALSE(a.contains(3));
+  EXPECT_EQ(*a.find(2), "2");
+  EXPECT_EQ(a.count(1), 1u);
+  EXPECT_EQ(*a.lower_bound(25), "30");
+  EXPECT_TRUE(a.upper_bound(30) == a.end());
+  auto range = a.equal_range(2);
+  EXPECT_EQ(*range.first, "2");
+  EXPECT_EQ(*range.second, "30");
+}
@@ -0,0 +1,98 @@
+#ifndef S21_SMALL_VECTOR_S21_SMALL_VECTOR_H_
+#define S21_SMALL_VECTOR_S21_SMALL_VECTOR_H_
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+
+// Вектор со встроенным буфером на N элементов: пока элементов не больше N,
+// память из кучи не выделяется. Интерфейс тот же, что у s21::vector,
+// поэтому подходит как параметр Vector для stack и queue.
+template <typename T, size_t N = 8>
+class small_vector : public vector<T> {
+  static_assert(N > 0, "small_vector needs a non-empty inline buffer");
+
+ public:
+  using value_type = typename vector<T>::value_type;
+  using size_type = typename vector<T>::size_type;
+
+  small_vector() noexcept;
+  explicit small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const &items);
+  small_vector(const small_vector &v);
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~small_vector();
+  small_vector &operator=(const small_vector &v);
+  small_vector &operator=(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+
+  void swap(small_vector &other);
+
+ private:
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+};
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector() noexcept
+    : vector<T>(reinterpret_cast<T *>(buffer_), N) {}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(size_type n) : small_vector() {
+  this->resize(n);
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(
+    std::initializer_list<value_type> const &items)
+    : small_vector() {
+  this->assign(items);
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(const small_vector &v)
+    : small_vector() {
+  this->assign(v.arr_, v.arr_ + v.size_);
+}
+
+// Приемник с тем же N вмещает встроенные элементы источника, поэтому
+// память не выделяется; бросить может только перенос самих элементов
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : small_vector() {
+  this->take(v);
+}
+
+// Элементы разрушаются здесь, пока буфер еще жив
+template <typename T, size_t N>
+inline small_vector<T, N>::~small_vector() {
+  this->delete_arr();
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N> &small_vector<T, N>::operator=(
+    const small_vector &v) {
+  vector<T>::operator=(v);
+  return *this;
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N> &small_vector<T, N>::operator=(
+    small_vector &&v) noexcept(std::is_nothrow_move_constructible_v<T>) {
+  vector<T>::operator=(std::move(v));
+  return *this;
+}
+
+// Через временный small_vector: при встроенных буферах обмен идет
+// поэлементно без выделения памяти, память из кучи переходит целиком
+template <typename T, size_t N>
+inline void small_vector<T, N>::swap(small_vector &other) {
+  small_vector tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+}  // namespace s21
+
+#endif  // S21_SMALL_VECTOR_S21_SMALL_VECTOR_H_
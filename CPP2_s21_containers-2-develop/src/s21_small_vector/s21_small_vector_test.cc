@@ -0,0 +1,100 @@
+#include "s21_small_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../s21_queue/s21_queue.h"
+#include "../s21_stack/s21_stack.h"
+#include "../tests.cpp"
+
+namespace {
+template <typename V>
+bool in_object(V &v) {
+  auto *begin = reinterpret_cast<const char *>(&v);
+  auto *data = reinterpret_cast<const char *>(v.data());
+  return data >= begin && data < begin + sizeof(v);
+}
+}  // namespace
+
+TEST(small_vector, inline_until_full) {
+  s21::small_vector<int, 4> v;
+  EXPECT_EQ(v.capacity(), 4U);
+  for (int i = 0; i < 4; ++i) v.push_back(i);
+  EXPECT_TRUE(in_object(v));
+  v.push_back(4);
+  EXPECT_FALSE(in_object(v));
+  EXPECT_EQ(v.capacity(), 8U);
+  EXPECT_EQ(v[4], 4);
+  v.resize(3);
+  v.shrink_to_fit();
+  EXPECT_TRUE(in_object(v));
+  EXPECT_EQ(v.capacity(), 4U);
+  EXPECT_EQ(v[2], 2);
+  v.clear();
+  v.shrink_to_fit();
+  EXPECT_TRUE(in_object(v));
+  EXPECT_EQ(v.capacity(), 4U);
+}
+
+TEST(small_vector, copy_move_swap) {
+  s21::small_vector<std::string, 2> a{"a", "b"};
+  s21::small_vector<std::string, 2> b{"c", "d", "e"};
+  s21::small_vector<std::string, 2> c(a);
+  EXPECT_TRUE(in_object(c));
+  EXPECT_EQ(c[1], "b");
+  a.swap(b);
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(a[2], "e");
+  EXPECT_EQ(b.size(), 2U);
+  EXPECT_EQ(b[0], "a");
+  EXPECT_TRUE(in_object(b));
+  s21::small_vector<std::string, 2> d(std::move(b));
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(d[1], "b");
+  d = std::move(a);
+  EXPECT_EQ(d.size(), 3U);
+  EXPECT_FALSE(in_object(d));
+  s21::vector<std::string> plain(std::move(d));
+  EXPECT_EQ(plain[2], "e");
+}
+
+struct ThrowingSmallMove {
+  ThrowingSmallMove() = default;
+  ThrowingSmallMove(const ThrowingSmallMove &) = default;
+  ThrowingSmallMove(ThrowingSmallMove &&) {}
+  ThrowingSmallMove &operator=(const ThrowingSmallMove &) = default;
+};
+
+// noexcept переноса следует за T, а не обещает больше, чем может
+static_assert(std::is_nothrow_move_constructible_v<s21::vector<std::string>>);
+static_assert(std::is_nothrow_move_assignable_v<s21::small_vector<int, 4>>);
+static_assert(
+    !std::is_nothrow_move_constructible_v<s21::vector<ThrowingSmallMove>>);
+static_assert(
+    !std::is_nothrow_move_assignable_v<s21::vector<ThrowingSmallMove>>);
+static_assert(!std::is_nothrow_move_assignable_v<
+              s21::small_vector<ThrowingSmallMove, 4>>);
+
+TEST(small_vector, throwing_move_into_plain_vector) {
+  s21::small_vector<ThrowingSmallMove, 4> small(3);
+  s21::vector<ThrowingSmallMove> plain(std::move(small));
+  EXPECT_EQ(plain.size(), 3U);
+  EXPECT_TRUE(small.empty());
+  s21::small_vector<ThrowingSmallMove, 4> other(2);
+  small = std::move(other);
+  EXPECT_EQ(small.size(), 2U);
+}
+
+TEST(small_vector, as_stack_and_queue_storage) {
+  s21::stack<int, s21::small_vector<int>> s{1, 2, 3};
+  s.push(4);
+  EXPECT_EQ(s.top(), 4);
+  s.pop();
+  EXPECT_EQ(s.size(), 3U);
+  s21::queue<std::string, s21::small_vector<std::string, 2>> q{"x", "y"};
+  q.push("z");
+  q.pop();
+  EXPECT_EQ(q.front(), "y");
+  EXPECT_EQ(q.back(), "z");
+}
@@ -0,0 +1,184 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace s21 {
+
+// Пул памяти под объекты T. Память берётся у Allocator блоками растущего
+// размера, освобождённые ячейки уходят в список свободных и выдаются снова,
+// release() возвращает аллокатору все блоки разом.
+template <typename T, typename Allocator = std::allocator<T>>
+class NodePool {
+ public:
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+
+  explicit NodePool(const Allocator& alloc = Allocator());
+  NodePool(const NodePool& other) = delete;
+  NodePool& operator=(const NodePool& other) = delete;
+  ~NodePool();
+
+  void* allocate();  // память под один T, без конструирования
+  void deallocate(void* p);
+  void release();  // все выданные ячейки становятся недействительны
+  void absorb(NodePool& other) noexcept;  // забирает блоки other себе
+  void swap(NodePool& other) noexcept;
+
+  allocator_type get_allocator() const;
+  size_type capacity() const;  // ячеек во всех блоках
+
+ private:
+  union Slot {
+    Slot* next;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  struct Block {
+    Block* next;
+    Slot* slots;
+    size_type count;
+  };
+
+  using traits = std::allocator_traits<Allocator>;
+  using slot_allocator = typename traits::template rebind_alloc<Slot>;
+  using block_allocator = typename traits::template rebind_alloc<Block>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+  using block_traits = std::allocator_traits<block_allocator>;
+
+  static constexpr size_type kFirstBlock = 8;
+  static constexpr size_type kMaxBlock = 1024;
+
+  slot_allocator slot_alloc;
+  block_allocator block_alloc;
+  Block* blocks;    // последний выделенный блок - первый в списке
+  Slot* free_list;  // освобождённые ячейки
+  size_type used;   // занятых ячеек в последнем блоке
+  size_type total;
+
+  void grow();
+};
+
+template <typename T, typename Allocator>
+NodePool<T, Allocator>::NodePool(const Allocator& alloc)
+    : slot_alloc(alloc),
+      block_alloc(alloc),
+      blocks(nullptr),
+      free_list(nullptr),
+      used(0),
+      total(0) {}
+
+template <typename T, typename Allocator>
+NodePool<T, Allocator>::~NodePool() {
+  release();
+}
+
+template <typename T, typename Allocator>
+void* NodePool<T, Allocator>::allocate() {
+  if (free_list) {
+    Slot* slot = free_list;
+    free_list = slot->next;
+    return slot->storage;
+  }
+  if (!blocks || used == blocks->count) grow();
+  return blocks->slots[used++].storage;
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::deallocate(void* p) {
+  Slot* slot = static_cast<Slot*>(p);
+  slot->next = free_list;
+  free_list = slot;
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::release() {
+  while (blocks) {
+    Block* next = blocks->next;
+    slot_traits::deallocate(slot_alloc, blocks->slots, blocks->count);
+    block_traits::deallocate(block_alloc, blocks, 1);
+    blocks = next;
+  }
+  free_list = nullptr;
+  used = 0;
+  total = 0;
+}
+
+// Нужен, когда узлы other переходят к владельцу этого пула (splice у
+// списка): выданные ячейки other остаются действительны, а его блоки
+// освободит этот пул. Аллокаторы пулов должны быть равны. other пустеет.
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::absorb(NodePool& other) noexcept {
+  if (this == &other || !other.blocks) return;
+  // незанятый хвост последнего блока other уходит в список свободных
+  for (size_type i = other.used; i < other.blocks->count; ++i) {
+    deallocate(other.blocks->slots[i].storage);
+  }
+  while (other.free_list) {
+    Slot* slot = other.free_list;
+    other.free_list = slot->next;
+    deallocate(slot);
+  }
+  Block* last = other.blocks;
+  while (last->next) last = last->next;
+  if (blocks) {
+    // блок, из которого идёт выдача, остается первым
+    last->next = blocks->next;
+    blocks->next = other.blocks;
+  } else {
+    last->next = nullptr;
+    blocks = other.blocks;
+    used = blocks->count;
+  }
+  total += other.total;
+  other.blocks = nullptr;
+  other.used = 0;
+  other.total = 0;
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::swap(NodePool& other) noexcept {
+  using std::swap;
+  swap(slot_alloc, other.slot_alloc);
+  swap(block_alloc, other.block_alloc);
+  swap(blocks, other.blocks);
+  swap(free_list, other.free_list);
+  swap(used, other.used);
+  swap(total, other.total);
+}
+
+template <typename T, typename Allocator>
+typename NodePool<T, Allocator>::allocator_type
+NodePool<T, Allocator>::get_allocator() const {
+  return allocator_type(slot_alloc);
+}
+
+template <typename T, typename Allocator>
+typename NodePool<T, Allocator>::size_type NodePool<T, Allocator>::capacity()
+    const {
+  return total;
+}
+
+// новый блок вдвое больше предыдущего, но не больше kMaxBlock
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::grow() {
+  size_type count = blocks ? blocks->count * 2 : kFirstBlock;
+  if (count > kMaxBlock) count = kMaxBlock;
+  Block* block = block_traits::allocate(block_alloc, 1);
+  try {
+    block->slots = slot_traits::allocate(slot_alloc, count);
+  } catch (...) {
+    block_traits::deallocate(block_alloc, block, 1);
+    throw;
+  }
+  block->count = count;
+  block->next = blocks;
+  blocks = block;
+  used = 0;
+  total += count;
+}
+
+}  // namespace s21
+#endif  // NODE_POOL_HPP
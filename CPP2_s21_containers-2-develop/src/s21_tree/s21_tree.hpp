@@ -1,12 +1,52 @@
+#include <functional>
+#include <iostream>
+#include <iterator>
 #include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
 
-#include "../s21_stack/s21_stack.h"
+#include "s21_node_pool.hpp"
 #ifndef TREE_CPP
 #define TREE_CPP
 
 namespace s21 {
 
-template <typename Key, typename Value>
+// значение узла дерева. Ключ хранится один раз: у set им служит само
+// значение, у map - first пары; в общем случае он лежит рядом со значением
+template <typename Key, typename Value>
+struct TreeNodeValue {
+  static constexpr bool kKeyInValue = false;
+  Key _key;
+  Value value;
+  template <typename K, typename... Args>
+  explicit TreeNodeValue(K&& k, Args&&... args)
+      : _key(std::forward<K>(k)), value(std::forward<Args>(args)...) {}
+  const Key& key() const { return _key; }
+};
+
+template <typename Key>
+struct TreeNodeValue<Key, Key> {
+  static constexpr bool kKeyInValue = true;
+  Key value;
+  template <typename... Args>
+  explicit TreeNodeValue(Args&&... args)
+      : value(std::forward<Args>(args)...) {}
+  const Key& key() const { return value; }
+};
+
+template <typename Key, typename T>
+struct TreeNodeValue<Key, std::pair<const Key, T>> {
+  static constexpr bool kKeyInValue = true;
+  std::pair<const Key, T> value;
+  template <typename... Args>
+  explicit TreeNodeValue(Args&&... args)
+      : value(std::forward<Args>(args)...) {}
+  const Key& key() const { return value.first; }
+};
+
+template <typename Key, typename Value, typename Compare = std::less<>,
+          typename Allocator = std::allocator<Value>>
 class Tree {
  public:
   class Iterator;
@@ -16,34 +56,64 @@ class Tree {
   using pair_type = std::pair<key_type, value_type>;
   using reference = Value&;
   using const_reference = const Value&;
-  using iterator = Tree<Key, Value>::Iterator;
-  using const_iterator = Tree<Key, Value>::Const_Iterator;
+  using iterator = Tree<Key, Value, Compare, Allocator>::Iterator;
+  using const_iterator = Tree<Key, Value, Compare, Allocator>::Const_Iterator;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+
+  struct Node;
 
-  struct Node {
-    key_type key;
-    value_type value;
+  // связи узла. Заголовок дерева - NodeBase высоты 0 без ключа: его left -
+  // корень, parent корня - заголовок, сам заголовок служит end()
+  struct NodeBase {
     size_type height;
+    size_type size;  // число узлов в поддереве
     Node* left;
     Node* right;
-    // Node(key_type k, value_type v) {key = k; value = v; height = 1; left =
-    // nullptr; right = nullptr;
-    // };
-    Node(key_type k, value_type v)
-        : key(k), value(v), height(1), left(nullptr), right(nullptr){};
+    NodeBase* parent;
+    NodeBase()
+        : height(0), size(0), left(nullptr), right(nullptr), parent(nullptr){};
+  };
+
+  struct Node : NodeBase, TreeNodeValue<Key, Value> {
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : NodeBase(), TreeNodeValue<Key, Value>(std::forward<Args>(args)...) {
+      this->height = 1;
+      this->size = 1;
+    };
   };
 
   Tree();
-  Tree(key_type k, value_type v);
+  explicit Tree(const Compare& comp);
+  Tree(const key_type& k, const value_type& v);
   Tree(std::initializer_list<key_type> const& items);
   Tree(std::initializer_list<pair_type> const& items);
   Tree(const Tree& other);
-  Tree(Tree&& other);
+  Tree(Tree&& other) noexcept;
   ~Tree();
 
-  void __insert(key_type k, value_type v);
-  void remove(key_type k);
-  Node* find(key_type k);
+  void __insert(const key_type& k, const value_type& v);
+  void remove(const key_type& k);
+  // поиск по любому K, сравнимому с ключом через Compare
+  template <typename K>
+  Node* find(const K& k);
+  template <typename K>
+  iterator find_iterator(const K& key);
+  template <typename K>
+  iterator lower_bound(const K& key);
+  template <typename K>
+  iterator upper_bound(const K& key);
+  template <typename K>
+  std::pair<iterator, iterator> equal_range(const K& key);
+  template <typename K>
+  size_type count(const K& key);
+  iterator nth_element(size_type k);
+  template <typename K>
+  size_type rank(const K& key);
+  template <typename K>
+  size_type count_range(const K& from, const K& to);
   void print();
   void clean();
 
@@ -55,156 +125,382 @@ class Tree {
   value_type& at(const key_type& key);
   value_type& operator[](const key_type& key);
 
-  bool contains(const key_type& key);
+  template <typename K>
+  bool contains(const K& key);
   void erase(iterator pos);
   bool empty();
-  void swap(Tree& other);
+  void swap(Tree& other) noexcept;
   void merge(Tree& other);
-  size_type size();
+  size_type size() const;
   size_type max_size();
+  allocator_type get_allocator() const;
+  key_compare key_comp() const;
 
   Tree& operator=(const Tree& other);
-  Tree& operator=(Tree&& other);
+  Tree& operator=(Tree&& other) noexcept;
 
   std::pair<iterator, bool> insert(const pair_type& value);
   std::pair<iterator, bool> insert(const key_type& key, const value_type& obj);
   std::pair<iterator, bool> insert_or_assign(const key_type& key,
                                              const value_type& obj);
+  // узел строится из args на месте; дубликат ключа уничтожается
+  template <typename... Args>
+  std::pair<iterator, bool> emplace_unique(Args&&... args);
+  // новый узел встаёт после равных ему
+  template <typename... Args>
+  iterator emplace_equal(Args&&... args);
+  // узел строится из args, только если ключа key ещё нет
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+  // вставка рядом с hint (перед ним): при верной подсказке без спуска от
+  // корня, иначе - обычной вставкой
+  template <typename... Args>
+  std::pair<iterator, bool> emplace_hint_unique(iterator hint, Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint_equal(iterator hint, Args&&... args);
+
+  // [first, last) упорядочен по key_of(*it): дерево строится за O(n)
+  template <typename ForwardIt, typename KeyOf>
+  void build_from_sorted(ForwardIt first, ForwardIt last, KeyOf key_of);
+  // упорядоченный диапазон - через build_from_sorted, иначе вставками;
+  // unique: повторяющиеся ключи пропускаются
+  template <typename ForwardIt, typename KeyOf>
+  void assign_range(ForwardIt first, ForwardIt last, KeyOf key_of,
+                    bool unique);
 
  private:
-  Node* root;
+  NodeBase header;
+  NodePool<Node, Allocator> pool;  // память всех узлов дерева
+  Compare comp;                    // порядок ключей
+  template <typename... Args>
+  Node* create_node(Args&&... args);
+  Node* make_node(const key_type& k, const value_type& v);
+  void destroy_node(Node* p);
+  Node* get_root() const;
+  void set_root(Node* p);
+  template <typename K>
+  NodeBase* bound(const K& key, bool upper);
+  template <typename K>
+  size_type _rank(const K& key, bool upper);
+  static const NodeBase* next_node(const NodeBase* node);
+  static const NodeBase* prev_node(const NodeBase* node);
   size_type height(Node* p);
-  size_type _size(Node* p);
+  static size_type _size(const Node* p);
   int balance_factor(Node* p);
-  void update_height(Node* p);
+  void update_node(Node* p);
   Node* rotate_right(Node* p);
   Node* rotate_left(Node* q);
   Node* balance(Node* p);
-  Node* _insert(Node* p, key_type k, value_type v);
+  Node* _insert(Node* p, Node* node);
+  bool _insert_hint(NodeBase* hint, Node* node, bool unique);
+  void fix_up(NodeBase* p);
   Node* find_min(Node* p);
   Node* remove_min(Node* p);
-  Node* _remove(Node* p, key_type k);
-  Node* _find(Node* p, key_type k);
+  Node* _remove(Node* p, const key_type& k);
+  void unlink_node(Node* p);
   void _clean(Node* p);
+  void _destroy(Node* p);
+  template <typename Source>
+  Node* _build(Source& next, size_type n);
   void assign(const Tree& other);
   void print_tree(Node* p, Node* parent);
 };
 
-template <typename Key, typename Value>
-Tree<Key, Value>::Tree() {
-  root = nullptr;
-}
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Tree<Key, Value, Compare, Allocator>::Tree() : header() {}
 
-template <typename Key, typename Value>
-Tree<Key, Value>::Tree(key_type k, value_type v) {
-  root = new Node(k, v);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Tree<Key, Value, Compare, Allocator>::Tree(const Compare& comp)
+    : header(), comp(comp) {}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Tree<Key, Value, Compare, Allocator>::Tree(const key_type& k,
+                                           const value_type& v)
+    : header() {
+  set_root(make_node(k, v));
 }
 
-template <typename Key, typename Value>
-Tree<Key, Value>::Tree(std::initializer_list<pair_type> const& items)
-    : root(nullptr) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Tree<Key, Value, Compare, Allocator>::Tree(
+    std::initializer_list<pair_type> const& items)
+    : header() {
   for (auto i = items.begin(); i != items.end(); ++i)
     __insert(i->first, i->second);
 }
 
-template <typename Key, typename Value>
-Tree<Key, Value>::Tree(std::initializer_list<key_type> const& items)
-    : root(nullptr) {
-  for (auto i = items.begin(); i != items.end(); ++i) __insert(*i, *i);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Tree<Key, Value, Compare, Allocator>::Tree(
+    std::initializer_list<key_type> const& items)
+    : header() {
+  assign_range(items.begin(), items.end(),
+               [](const key_type& k) -> const key_type& { return k; }, false);
 }
 
-template <typename Key, typename Value>
-Tree<Key, Value>::Tree(const Tree& other) {
-  root = nullptr;
-  assign(other);
+// копия строится по порядку обхода other за O(n), без поворотов
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Tree<Key, Value, Compare, Allocator>::Tree(const Tree& other)
+    : header(), pool(other.get_allocator()), comp(other.comp) {
+  const_iterator it = other.cbegin();
+  auto next = [this, &it]() {
+    const Node* src = it.get_node();
+    ++it;
+    return make_node(src->key(), src->value);
+  };
+  set_root(_build(next, other.size()));
 }
 
-template <typename Key, typename Value>
-Tree<Key, Value>::Tree(Tree&& other) {
-  assign(other);
-  other.clean();
+// узлы и пул забираются у other, other остаётся пустым
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Tree<Key, Value, Compare, Allocator>::Tree(Tree&& other) noexcept
+    : header(), pool(other.get_allocator()), comp(other.comp) {
+  swap(other);
 }
 
-template <typename Key, typename Value>
-Tree<Key, Value>::~Tree() {}
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Tree<Key, Value, Compare, Allocator>::~Tree() {
+  clean();
+}
 
 // public methods
 
-template <typename Key, typename Value>
-void Tree<Key, Value>::__insert(key_type k, value_type v) {
-  root = _insert(root, k, v);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::__insert(const key_type& k,
+                                                    const value_type& v) {
+  set_root(_insert(get_root(), make_node(k, v)));
 }
 
-template <typename Key, typename Value>
-void Tree<Key, Value>::remove(key_type k) {
-  root = _remove(root, k);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::remove(const key_type& k) {
+  set_root(_remove(get_root(), k));
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::find(key_type k) {
-  if (!root) return nullptr;
-  Node* result = _find(root, k);
-  if (result)
-    return result;
-  else
-    return nullptr;
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::find(const K& k) {
+  NodeBase* p = bound(k, false);
+  if (p == &header || comp(k, static_cast<Node*>(p)->key())) return nullptr;
+  return static_cast<Node*>(p);
 }
 
-template <typename Key, typename Value>
-inline void Tree<Key, Value>::print() {
-  print_tree(root, nullptr);
+// итератор на первый узел с ключом key или end()
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+typename Tree<Key, Value, Compare, Allocator>::iterator
+Tree<Key, Value, Compare, Allocator>::find_iterator(const K& key) {
+  iterator it = lower_bound(key);
+  if (it.get_node() && comp(key, it.get_ckey())) return end();
+  return it;
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+typename Tree<Key, Value, Compare, Allocator>::iterator
+Tree<Key, Value, Compare, Allocator>::lower_bound(const K& key) {
+  return iterator(bound(key, false));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+typename Tree<Key, Value, Compare, Allocator>::iterator
+Tree<Key, Value, Compare, Allocator>::upper_bound(const K& key) {
+  return iterator(bound(key, true));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+std::pair<typename Tree<Key, Value, Compare, Allocator>::iterator,
+          typename Tree<Key, Value, Compare, Allocator>::iterator>
+Tree<Key, Value, Compare, Allocator>::equal_range(const K& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+// число элементов с ключом key: два спуска по размерам поддеревьев
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+typename Tree<Key, Value, Compare, Allocator>::size_type
+Tree<Key, Value, Compare, Allocator>::count(const K& key) {
+  return _rank(key, true) - _rank(key, false);
+}
+
+// k-й по порядку элемент (с нуля) или end(), за O(log n)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::iterator
+Tree<Key, Value, Compare, Allocator>::nth_element(size_type k) {
+  Node* p = get_root();
+  while (p) {
+    size_type left = _size(p->left);
+    if (k == left) return iterator(p);
+    if (k < left) {
+      p = p->left;
+    } else {
+      k -= left + 1;
+      p = p->right;
+    }
+  }
+  return end();
+}
+
+// число элементов с ключом меньше key - индекс lower_bound(key)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+typename Tree<Key, Value, Compare, Allocator>::size_type
+Tree<Key, Value, Compare, Allocator>::rank(const K& key) {
+  return _rank(key, false);
+}
+
+// число элементов с ключом из [from, to)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+typename Tree<Key, Value, Compare, Allocator>::size_type
+Tree<Key, Value, Compare, Allocator>::count_range(const K& from, const K& to) {
+  if (!comp(from, to)) return 0;
+  return _rank(to, false) - _rank(from, false);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline void Tree<Key, Value, Compare, Allocator>::print() {
+  print_tree(get_root(), nullptr);
 }
 
 // private methods
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::size_type Tree<Key, Value>::height(Node* p) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::get_root() const {
+  return header.left;
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline void Tree<Key, Value, Compare, Allocator>::set_root(Node* p) {
+  header.left = p;
+  if (p) p->parent = &header;
+}
+
+// первый узел с ключом >= key (upper: > key) или заголовок, за O(log n)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+typename Tree<Key, Value, Compare, Allocator>::NodeBase*
+Tree<Key, Value, Compare, Allocator>::bound(const K& key, bool upper) {
+  NodeBase* result = &header;
+  Node* p = get_root();
+  while (p) {
+    if (upper ? comp(key, p->key()) : !comp(p->key(), key)) {
+      result = p;
+      p = p->left;
+    } else {
+      p = p->right;
+    }
+  }
+  return result;
+}
+
+// число элементов с ключом < key (upper: <= key)
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+typename Tree<Key, Value, Compare, Allocator>::size_type
+Tree<Key, Value, Compare, Allocator>::_rank(const K& key, bool upper) {
+  size_type result = 0;
+  Node* p = get_root();
+  while (p) {
+    if (upper ? !comp(key, p->key()) : comp(p->key(), key)) {
+      result += _size(p->left) + 1;
+      p = p->right;
+    } else {
+      p = p->left;
+    }
+  }
+  return result;
+}
+
+// следующий по порядку узел; за последним - заголовок, за заголовком - он же
+template <typename Key, typename Value, typename Compare, typename Allocator>
+const typename Tree<Key, Value, Compare, Allocator>::NodeBase*
+Tree<Key, Value, Compare, Allocator>::next_node(const NodeBase* node) {
+  if (node->right) {
+    node = node->right;
+    while (node->left) node = node->left;
+    return node;
+  }
+  const NodeBase* parent = node->parent;
+  while (parent && node == parent->right) {
+    node = parent;
+    parent = parent->parent;
+  }
+  return parent ? parent : node;
+}
+
+// предыдущий узел; перед заголовком - максимум, перед минимумом - заголовок
+template <typename Key, typename Value, typename Compare, typename Allocator>
+const typename Tree<Key, Value, Compare, Allocator>::NodeBase*
+Tree<Key, Value, Compare, Allocator>::prev_node(const NodeBase* node) {
+  if (node->left) {
+    node = node->left;
+    while (node->right) node = node->right;
+    return node;
+  }
+  const NodeBase* parent = node->parent;
+  while (parent && node == parent->left) {
+    node = parent;
+    parent = parent->parent;
+  }
+  return parent ? parent : node;
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::size_type
+Tree<Key, Value, Compare, Allocator>::height(Node* p) {
   return p ? p->height : 0;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::size_type Tree<Key, Value>::_size(Node* p) {
-  if (!p) return 0;
-  size_type left = p->left ? _size(p->left) : 0;
-  size_type right = p->right ? _size(p->right) : 0;
-  return left + right + 1;
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::size_type
+Tree<Key, Value, Compare, Allocator>::_size(const Node* p) {
+  return p ? p->size : 0;
 }
 
-template <typename Key, typename Value>
-inline int Tree<Key, Value>::balance_factor(Node* p) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline int Tree<Key, Value, Compare, Allocator>::balance_factor(Node* p) {
   return height(p->right) - height(p->left);
 }
 
-template <typename Key, typename Value>
-inline void Tree<Key, Value>::update_height(Node* p) {
+// пересчёт высоты, размера поддерева узла и ссылок детей на него
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline void Tree<Key, Value, Compare, Allocator>::update_node(Node* p) {
   size_type height_left = height(p->left);
   size_type height_right = height(p->right);
   p->height = (height_left > height_right ? height_left : height_right) + 1;
+  p->size = _size(p->left) + _size(p->right) + 1;
+  if (p->left) p->left->parent = p;
+  if (p->right) p->right->parent = p;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::rotate_right(Node* p) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::rotate_right(Node* p) {
   Node* q = p->left;
   p->left = q->right;
   q->right = p;
-  update_height(p);
-  update_height(q);
+  update_node(p);
+  update_node(q);
   return q;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::rotate_left(Node* q) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::rotate_left(Node* q) {
   Node* p = q->right;
   q->right = p->left;
   p->left = q;
-  update_height(q);
-  update_height(p);
+  update_node(q);
+  update_node(p);
   return p;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::balance(Node* p) {
-  update_height(p);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::balance(Node* p) {
+  update_node(p);
   if (balance_factor(p) == 2) {
     if (balance_factor(p->right) < 0) p->right = rotate_right(p->right);
     return rotate_left(p);
@@ -216,229 +512,316 @@ typename Tree<Key, Value>::Node* Tree<Key, Value>::balance(Node* p) {
   return p;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::_insert(Node* p, key_type k,
-                                                           value_type v) {
-  if (!p) return new Node(k, v);
-  if (k < p->key) {
-    p->left = _insert(p->left, k, v);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::_insert(Node* p, Node* node) {
+  if (!p) return node;
+  if (comp(node->key(), p->key())) {
+    p->left = _insert(p->left, node);
   } else {
-    p->right = _insert(p->right, k, v);
+    p->right = _insert(p->right, node);
   }
   return balance(p);
 }
 
-template <typename Key, typename Value>
-inline void Tree<Key, Value>::print_tree(Node* p, Node* parent) {
+// node встаёт между prev_node(hint) и hint, если его ключ между ними: к
+// hint слева или к предшественнику справа, одно из мест всегда свободно.
+// Ключи сравниваются дважды, выше узла только пересчёт и повороты
+template <typename Key, typename Value, typename Compare, typename Allocator>
+bool Tree<Key, Value, Compare, Allocator>::_insert_hint(NodeBase* hint,
+                                                        Node* node,
+                                                        bool unique) {
+  if (!get_root()) {
+    set_root(node);
+    return true;
+  }
+  if (!hint) return false;
+  const key_type& key = node->key();
+  NodeBase* prev = const_cast<NodeBase*>(prev_node(hint));
+  if (prev != &header) {
+    const key_type& prev_key = static_cast<Node*>(prev)->key();
+    if (unique ? !comp(prev_key, key) : comp(key, prev_key)) return false;
+  }
+  if (hint != &header) {
+    const key_type& hint_key = static_cast<Node*>(hint)->key();
+    if (unique ? !comp(key, hint_key) : comp(hint_key, key)) return false;
+  }
+  if (hint != &header && !hint->left) {
+    hint->left = node;
+    node->parent = hint;
+  } else {
+    prev->right = node;
+    node->parent = prev;
+  }
+  fix_up(node->parent);
+  return true;
+}
+
+// пересчёт и балансировка узлов от p до корня по ссылкам на родителя
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::fix_up(NodeBase* p) {
+  while (p != &header) {
+    Node* node = static_cast<Node*>(p);
+    NodeBase* parent = node->parent;
+    Node* balanced = balance(node);
+    if (parent == &header) {
+      set_root(balanced);
+    } else if (parent->left == node) {
+      parent->left = balanced;
+    } else {
+      parent->right = balanced;
+    }
+    balanced->parent = parent;
+    p = parent;
+  }
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline void Tree<Key, Value, Compare, Allocator>::print_tree(Node* p,
+                                                             Node* parent) {
   if (parent)
-    std::cout << "Parent: " << parent->key << "; Key: " << p->key
+    std::cout << "Parent: " << parent->key() << "; Key: " << p->key()
               << "; Value: " << p->value << "; height: " << p->height
               << "; BF: " << balance_factor(p) << std::endl;
   else
-    std::cout << "Key: " << p->key << "; Value: " << p->value
+    std::cout << "Key: " << p->key() << "; Value: " << p->value
               << "; height: " << p->height << "; BF: " << balance_factor(p)
               << std::endl;
   if (p->left) print_tree(p->left, p);
   if (p->right) print_tree(p->right, p);
 }
 
-template <typename Key, typename Value>
-inline void Tree<Key, Value>::clean() {
-  // if (root) _clean(root);
-  if (root) {
-    if (root->left) _clean(root->left);
-    if (root->right) _clean(root->right);
-    delete root;
-    root = nullptr;
-  }
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline void Tree<Key, Value, Compare, Allocator>::clean() {
+  if (!std::is_trivially_destructible<Node>::value) _clean(get_root());
+  pool.release();  // память всех узлов - одним проходом по блокам пула
+  set_root(nullptr);
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::iterator Tree<Key, Value>::begin() {
-  return iterator(root);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::iterator
+Tree<Key, Value, Compare, Allocator>::begin() {
+  NodeBase* node = &header;
+  while (node->left) node = node->left;
+  return iterator(node);
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::iterator Tree<Key, Value>::end() {
-  iterator res(root);
-  return res.to_end(root);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::iterator
+Tree<Key, Value, Compare, Allocator>::end() {
+  return iterator(&header);
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::const_iterator Tree<Key, Value>::cbegin() const {
-  return const_iterator(root);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::const_iterator
+Tree<Key, Value, Compare, Allocator>::cbegin() const {
+  const NodeBase* node = &header;
+  while (node->left) node = node->left;
+  return const_iterator(node);
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::const_iterator Tree<Key, Value>::cend() const {
-  const_iterator res(root);
-  return res.to_end(root);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::const_iterator
+Tree<Key, Value, Compare, Allocator>::cend() const {
+  return const_iterator(&header);
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::value_type& Tree<Key, Value>::at(
-    const key_type& key) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::value_type&
+Tree<Key, Value, Compare, Allocator>::at(const key_type& key) {
   Node* tmp = find(key);
   if (!tmp) throw std::out_of_range("at(key): No key or tree is empty.");
   return tmp->value;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::value_type& Tree<Key, Value>::operator[](
-    const key_type& key) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::value_type&
+Tree<Key, Value, Compare, Allocator>::operator[](const key_type& key) {
   Node* node = find(key);
-  if (node) {
-    return node->value;
-  } else {
-    __insert(key, Value());  // Вставляем новый элемент с ключом и значением по
-                             // умолчанию для типа Value
-    return find(key)->value;  // Возвращаем ссылку на значение нового элемента
+  if (!node) {
+    node = make_node(key, Value());  // новый элемент со значением по умолчанию
+    set_root(_insert(get_root(), node));
   }
+  return node->value;
 }
 
-template <typename Key, typename Value>
-inline bool Tree<Key, Value>::contains(const key_type& key) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename K>
+inline bool Tree<Key, Value, Compare, Allocator>::contains(const K& key) {
   Node* tmp = find(key);
   return tmp ? true : false;
 }
 
-template <typename Key, typename Value>
-void Tree<Key, Value>::erase(iterator pos) {
-  key_type key = pos.get_node()->key;
-  remove(key);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::erase(iterator pos) {
+  // удаляется именно узел pos, а не какой-то равный ему по Compare
+  unlink_node(const_cast<Node*>(pos.get_node()));
 }
 
-template <typename Key, typename Value>
-inline bool Tree<Key, Value>::empty() {
-  return root ? false : true;
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline bool Tree<Key, Value, Compare, Allocator>::empty() {
+  return get_root() ? false : true;
 }
 
-template <typename Key, typename Value>
-void Tree<Key, Value>::swap(Tree& other) {
-  Tree tmp(other);
-  other.clean();
-  other.root = nullptr;
-  other.assign(*this);
-  clean();
-  root = nullptr;
-  assign(tmp);
-  tmp.clean();
+// обмен корнями и пулами за O(1), узлы не копируются
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::swap(Tree& other) noexcept {
+  if (this == &other) return;
+  Node* root = get_root();
+  set_root(other.get_root());
+  other.set_root(root);
+  pool.swap(other.pool);
+  std::swap(comp, other.comp);
 }
 
-template <typename Key, typename Value>
-void Tree<Key, Value>::merge(Tree& other) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::merge(Tree& other) {
   assign(other);
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::size_type Tree<Key, Value>::size() {
-  return _size(root);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::size_type
+Tree<Key, Value, Compare, Allocator>::size() const {
+  return _size(get_root());
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Tree& Tree<Key, Value>::operator=(
-    const Tree& other) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Tree&
+Tree<Key, Value, Compare, Allocator>::operator=(const Tree& other) {
   if (this != &other) {
-    this->clean();
-    // clean();
-    root = nullptr;
-    new (this) Tree(other);
+    Tree tmp(other);
+    swap(tmp);
   }
   return *this;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Tree& Tree<Key, Value>::operator=(Tree&& other) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Tree&
+Tree<Key, Value, Compare, Allocator>::operator=(Tree&& other) noexcept {
   if (this != &other) {
-    this->clean();
-    root = nullptr;
-    new (this) Tree(std::move(other));
+    clean();
+    swap(other);
   }
   return *this;
 }
 
-template <typename Key, typename Value>
-std::pair<typename Tree<Key, Value>::iterator, bool> Tree<Key, Value>::insert(
-    const pair_type& value) {
-  Node* tmp = find(value.first);
-  bool result = false;
-  if (!tmp) {
-    __insert(value.first, value.second);
-    result = true;
-  }
-  auto iter = begin();
-  auto it_end = end();
-  while (iter != it_end) {
-    if (iter.get_node()->key == value.first) break;
-    ++iter;
-  }
-  return std::pair<iterator, bool>(iter, result);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+std::pair<typename Tree<Key, Value, Compare, Allocator>::iterator, bool>
+Tree<Key, Value, Compare, Allocator>::insert(const pair_type& value) {
+  return insert(value.first, value.second);
 }
 
-template <typename Key, typename Value>
-std::pair<typename Tree<Key, Value>::iterator, bool> Tree<Key, Value>::insert(
-    const key_type& key, const value_type& obj) {
-  Node* tmp = find(key);
-  bool result = false;
-  if (!tmp) {
-    __insert(key, obj);
-    result = true;
-  }
-  auto iter = begin();
-  auto it_end = end();
-  while (iter != it_end) {
-    if (iter.get_node()->key == key) break;
-    ++iter;
+template <typename Key, typename Value, typename Compare, typename Allocator>
+std::pair<typename Tree<Key, Value, Compare, Allocator>::iterator, bool>
+Tree<Key, Value, Compare, Allocator>::insert(const key_type& key,
+                                             const value_type& obj) {
+  Node* node = find(key);
+  if (node) return std::pair<iterator, bool>(iterator(node), false);
+  node = make_node(key, obj);
+  set_root(_insert(get_root(), node));
+  return std::pair<iterator, bool>(iterator(node), true);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+std::pair<typename Tree<Key, Value, Compare, Allocator>::iterator, bool>
+Tree<Key, Value, Compare, Allocator>::insert_or_assign(const key_type& key,
+                                                       const value_type& obj) {
+  std::pair<iterator, bool> result = insert(key, obj);
+  if (!result.second) *result.first = obj;
+  return std::pair<iterator, bool>(result.first, true);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+std::pair<typename Tree<Key, Value, Compare, Allocator>::iterator, bool>
+Tree<Key, Value, Compare, Allocator>::emplace_unique(Args&&... args) {
+  Node* node = create_node(std::forward<Args>(args)...);
+  Node* existing = find(node->key());
+  if (existing) {
+    destroy_node(node);
+    return std::pair<iterator, bool>(iterator(existing), false);
   }
-  return std::pair<iterator, bool>(iter, result);
+  set_root(_insert(get_root(), node));
+  return std::pair<iterator, bool>(iterator(node), true);
 }
 
-template <typename Key, typename Value>
-std::pair<typename Tree<Key, Value>::iterator, bool>
-Tree<Key, Value>::insert_or_assign(const key_type& key, const value_type& obj) {
-  Node* tmp = find(key);
-  bool result = false;
-  if (!tmp) {
-    __insert(key, obj);
-    result = true;
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+typename Tree<Key, Value, Compare, Allocator>::iterator
+Tree<Key, Value, Compare, Allocator>::emplace_equal(Args&&... args) {
+  Node* node = create_node(std::forward<Args>(args)...);
+  set_root(_insert(get_root(), node));
+  return iterator(node);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+std::pair<typename Tree<Key, Value, Compare, Allocator>::iterator, bool>
+Tree<Key, Value, Compare, Allocator>::try_emplace(const key_type& key,
+                                                  Args&&... args) {
+  Node* node = find(key);
+  if (node) return std::pair<iterator, bool>(iterator(node), false);
+  node = create_node(std::forward<Args>(args)...);
+  set_root(_insert(get_root(), node));
+  return std::pair<iterator, bool>(iterator(node), true);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+std::pair<typename Tree<Key, Value, Compare, Allocator>::iterator, bool>
+Tree<Key, Value, Compare, Allocator>::emplace_hint_unique(iterator hint,
+                                                          Args&&... args) {
+  Node* node = create_node(std::forward<Args>(args)...);
+  if (_insert_hint(hint.ptr, node, true)) {
+    return std::pair<iterator, bool>(iterator(node), true);
   }
-  if (!result) {
-    find(key)->value = obj;
-    result = true;
+  Node* existing = find(node->key());
+  if (existing) {
+    destroy_node(node);
+    return std::pair<iterator, bool>(iterator(existing), false);
   }
-  auto iter = begin();
-  auto it_end = end();
-  while (iter != it_end) {
-    if (iter.get_node()->key == key) break;
-    ++iter;
+  set_root(_insert(get_root(), node));
+  return std::pair<iterator, bool>(iterator(node), true);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+typename Tree<Key, Value, Compare, Allocator>::iterator
+Tree<Key, Value, Compare, Allocator>::emplace_hint_equal(iterator hint,
+                                                         Args&&... args) {
+  Node* node = create_node(std::forward<Args>(args)...);
+  if (!_insert_hint(hint.ptr, node, false)) {
+    set_root(_insert(get_root(), node));
   }
-  return std::pair<iterator, bool>(iter, result);
+  return iterator(node);
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::find_min(Node* p) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::find_min(Node* p) {
   return p->left ? find_min(p->left) : p;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::remove_min(Node* p) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::remove_min(Node* p) {
   if (p->left == nullptr) return p->right;
   p->left = remove_min(p->left);
   return balance(p);
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::_remove(Node* p,
-                                                           key_type k) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::_remove(Node* p, const key_type& k) {
   if (!p) return 0;
-  if (k < p->key) {
+  if (comp(k, p->key())) {
     p->left = _remove(p->left, k);
-  } else if (k > p->key) {
+  } else if (comp(p->key(), k)) {
     p->right = _remove(p->right, k);
   } else {
     Node* left = p->left;
     Node* right = p->right;
-    delete p;
+    destroy_node(p);
     if (right == nullptr) return left;
     Node* min = find_min(right);
     min->right = remove_min(right);
@@ -448,71 +831,207 @@ typename Tree<Key, Value>::Node* Tree<Key, Value>::_remove(Node* p,
   return balance(p);
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::_find(Node* p, key_type k) {
-  if (p->key == k) {
-    return p;
-  } else if (k > p->key && p->right) {
-    return _find(p->right, k);
-  } else if (k < p->key && p->left) {
-    return _find(p->left, k);
+// Вырезает узел по ссылкам на родителя, без поиска по ключу. Место узла
+// занимает минимум правого поддерева (или левый ребёнок, если правого нет),
+// затем fix_up балансирует путь от самого нижнего изменённого узла.
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::unlink_node(Node* p) {
+  NodeBase* parent = p->parent;
+  Node* left = p->left;
+  Node* right = p->right;
+  Node* replacement = left;
+  NodeBase* start = parent;
+  if (right) {
+    Node* min = find_min(right);
+    if (min == right) {
+      start = min;
+    } else {
+      NodeBase* min_parent = min->parent;
+      min_parent->left = min->right;
+      if (min->right) min->right->parent = min_parent;
+      min->right = right;
+      right->parent = min;
+      start = min_parent;
+    }
+    min->left = left;
+    if (left) left->parent = min;
+    replacement = min;
+  }
+  if (parent == &header) {
+    set_root(replacement);
+  } else {
+    if (parent->left == p) {
+      parent->left = replacement;
+    } else {
+      parent->right = replacement;
+    }
+    if (replacement) replacement->parent = parent;
   }
-  return nullptr;
+  destroy_node(p);
+  fix_up(start);
 }
 
-template <typename Key, typename Value>
-void Tree<Key, Value>::_clean(Node* p) {
+// деструкторы узлов поддерева; память освобождает pool.release()
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::_clean(Node* p) {
   if (p) {
     _clean(p->left);
     _clean(p->right);
-    delete p;
+    p->~Node();
   }
 }
 
-template <typename Key, typename Value>
-inline void Tree<Key, Value>::assign(const Tree<Key, Value>& other) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename... Args>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::create_node(Args&&... args) {
+  void* memory = pool.allocate();
+  try {
+    return new (memory) Node(std::forward<Args>(args)...);
+  } catch (...) {
+    pool.deallocate(memory);
+    throw;
+  }
+}
+
+// узел из пары ключ-значение; если ключ входит в значение, k не копируется
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::make_node(const key_type& k,
+                                                const value_type& v) {
+  if constexpr (TreeNodeValue<Key, Value>::kKeyInValue) {
+    return create_node(v);
+  } else {
+    return create_node(k, v);
+  }
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::destroy_node(Node* p) {
+  p->~Node();
+  pool.deallocate(p);
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename ForwardIt, typename KeyOf>
+void Tree<Key, Value, Compare, Allocator>::build_from_sorted(ForwardIt first,
+                                                             ForwardIt last,
+                                                             KeyOf key_of) {
+  clean();
+  size_type n = 0;
+  for (ForwardIt i = first; i != last; ++i) ++n;
+  auto next = [this, &first, &key_of]() {
+    Node* p = make_node(key_of(*first), *first);
+    ++first;
+    return p;
+  };
+  set_root(_build(next, n));
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename ForwardIt, typename KeyOf>
+void Tree<Key, Value, Compare, Allocator>::assign_range(ForwardIt first,
+                                                        ForwardIt last,
+                                                        KeyOf key_of,
+                                                        bool unique) {
+  bool sorted = true;
+  if (first != last) {
+    ForwardIt prev = first;
+    for (ForwardIt i = std::next(first); sorted && i != last; prev = i++) {
+      sorted = unique ? comp(key_of(*prev), key_of(*i))
+                      : !comp(key_of(*i), key_of(*prev));
+    }
+  }
+  if (sorted) {
+    build_from_sorted(first, last, key_of);
+  } else {
+    clean();
+    for (; first != last; ++first) {
+      if (!unique || !find(key_of(*first))) __insert(key_of(*first), *first);
+    }
+  }
+}
+
+// n узлов, которые next() выдаёт по возрастанию: левая половина, корень,
+// правая половина. Высоты поддеревьев отличаются не больше чем на 1
+template <typename Key, typename Value, typename Compare, typename Allocator>
+template <typename Source>
+typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::_build(Source& next, size_type n) {
+  if (n == 0) return nullptr;
+  Node* left = _build(next, n / 2);
+  Node* p = nullptr;
+  try {
+    p = next();
+  } catch (...) {
+    _destroy(left);
+    throw;
+  }
+  p->left = left;
+  try {
+    p->right = _build(next, n - n / 2 - 1);
+  } catch (...) {
+    _destroy(p);
+    throw;
+  }
+  update_node(p);
+  return p;
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+void Tree<Key, Value, Compare, Allocator>::_destroy(Node* p) {
+  if (p) {
+    _destroy(p->left);
+    _destroy(p->right);
+    destroy_node(p);
+  }
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline void Tree<Key, Value, Compare, Allocator>::assign(
+    const Tree<Key, Value, Compare, Allocator>& other) {
   for (auto i = other.cbegin(); i != other.cend(); ++i) {
     const Node* tmp = i.get_node();
-    this->__insert(tmp->key, tmp->value);
+    this->__insert(tmp->key(), tmp->value);
   }
 }
 
-template <class Key, class Value>
-size_t Tree<Key, Value>::max_size() {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+size_t Tree<Key, Value, Compare, Allocator>::max_size() {
   size_t max_size = 0;
   max_size = std::numeric_limits<size_t>::max() /
-             sizeof(typename s21::Tree<Key, Value>::Node) * 1.2;
+             sizeof(Node) * 1.2;
 
   return max_size;
 }
 
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::allocator_type
+Tree<Key, Value, Compare, Allocator>::get_allocator() const {
+  return pool.get_allocator();
+}
+
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::key_compare
+Tree<Key, Value, Compare, Allocator>::key_comp() const {
+  return comp;
+}
+
 //
 //
 //
 //
 
-template <typename Key, typename Value>
-class Tree<Key, Value>::Iterator {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+class Tree<Key, Value, Compare, Allocator>::Iterator {
  private:
-  Node* begin;
-  Node* ptr;
-  Node* end;
-
-  s21::stack<Node*> stack;
-  s21::stack<Node*> prev_stack;
-
- protected:
-  void left_to_stack(Node* node);
-  Node* next();
-  Node* prev();
-
-  Node* get_min(Node* node);
-  Node* get_max(Node* node);
+  NodeBase* ptr;  // узел или заголовок дерева (end())
+  friend class Tree<Key, Value, Compare, Allocator>;
 
  public:
-  Iterator() = default;
-  Iterator(Node* node);
-  Iterator(const Iterator& it);
+  Iterator() : ptr(nullptr) {}
+  Iterator(NodeBase* node) : ptr(node) {}
+  Iterator(const Iterator& it) = default;
   ~Iterator() = default;
 
   Iterator& operator++();
@@ -528,104 +1047,50 @@ class Tree<Key, Value>::Iterator {
   bool operator==(const Iterator& other) const;
   bool operator!=(const Iterator& other) const;
 
-  Iterator& operator=(const Iterator& it);
+  Iterator& operator=(const Iterator& it) = default;
 
   const Key& get_ckey() const;
   const Node* get_node() const;
-  Iterator to_end(Node* node);
 };
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::Iterator::get_min(
-    Node* node) {
-  if (!node) return nullptr;
-  if (node->left)
-    return get_min(node->left);
-  else
-    return node;
-}
-
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::Iterator::get_max(
-    Node* node) {
-  if (!node) return nullptr;
-  if (node->right)
-    return get_max(node->right);
-  else
-    return node;
-}
-
-template <typename Key, typename Value>
-inline const Key& Tree<Key, Value>::Iterator::get_ckey() const {
-  return ptr->key;
-}
-
-template <typename Key, typename Value>
-const typename Tree<Key, Value>::Node* Tree<Key, Value>::Iterator::get_node()
-    const {
-  return ptr;
-}
-
-template <typename Key, typename Value>
-inline void Tree<Key, Value>::Iterator::left_to_stack(Node* node) {
-  while (node) {
-    stack.push(node);
-    node = node->left;
-  }
-}
-
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::Iterator::next() {
-  if (stack.empty()) return nullptr;
-  Node* node = stack.top();
-  stack.pop();
-  prev_stack.push(node);
-  left_to_stack(node->right);
-  return node;
-}
-
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::Iterator::prev() {
-  if (prev_stack.empty()) return nullptr;
-  Node* node = prev_stack.top();
-  prev_stack.pop();
-  stack.push(node);
-  return node;
+template <typename Key, typename Value, typename Compare, typename Allocator>
+inline const Key& Tree<Key, Value, Compare, Allocator>::Iterator::get_ckey(
+    ) const {
+  return static_cast<const Node*>(ptr)->key();
 }
 
-template <typename Key, typename Value>
-Tree<Key, Value>::Iterator::Iterator(Node* node) {
-  left_to_stack(node);
-  ptr = next();
+// nullptr для end() и итератора по умолчанию
+template <typename Key, typename Value, typename Compare, typename Allocator>
+const typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::Iterator::get_node() const {
+  return ptr && ptr->height ? static_cast<const Node*>(ptr) : nullptr;
 }
 
-template <typename Key, typename Value>
-Tree<Key, Value>::Iterator::Iterator(const Iterator& it)
-    : ptr(it.ptr), stack(it.stack), prev_stack(it.prev_stack) {}
-
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Iterator& Tree<Key, Value>::Iterator::operator++() {
-  ptr = next();
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Iterator&
+Tree<Key, Value, Compare, Allocator>::Iterator::operator++() {
+  ptr = const_cast<NodeBase*>(next_node(ptr));
   return *this;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Iterator& Tree<Key, Value>::Iterator::operator--() {
-  ptr = prev();
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Iterator&
+Tree<Key, Value, Compare, Allocator>::Iterator::operator--() {
+  ptr = const_cast<NodeBase*>(prev_node(ptr));
   return *this;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Iterator Tree<Key, Value>::Iterator::operator++(
-    int) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Iterator
+Tree<Key, Value, Compare, Allocator>::Iterator::operator++(int) {
   iterator it(*this);
   ++(*this);
   return it;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Iterator Tree<Key, Value>::Iterator::operator--(
-    int) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Iterator
+Tree<Key, Value, Compare, Allocator>::Iterator::operator--(int) {
   iterator it(*this);
   --(*this);
   return it;
@@ -635,24 +1100,25 @@ typename Tree<Key, Value>::Iterator Tree<Key, Value>::Iterator::operator--(
 //
 //
 //
-template <typename Key, typename Value>
-Value& Tree<Key, Value>::Iterator::operator*() {
-  return ptr->value;
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Value& Tree<Key, Value, Compare, Allocator>::Iterator::operator*() {
+  return static_cast<Node*>(ptr)->value;
 }
 
-template <typename Key, typename Value>
-const Value& Tree<Key, Value>::Iterator::operator*() const {
-  return ptr->value;
+template <typename Key, typename Value, typename Compare, typename Allocator>
+const Value& Tree<Key, Value, Compare, Allocator>::Iterator::operator*() const {
+  return static_cast<const Node*>(ptr)->value;
 }
 
-template <typename Key, typename Value>
-Value* Tree<Key, Value>::Iterator::operator->() {
-  return &(ptr->value);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+Value* Tree<Key, Value, Compare, Allocator>::Iterator::operator->() {
+  return &(static_cast<Node*>(ptr)->value);
 }
 
-template <typename Key, typename Value>
-const Value* Tree<Key, Value>::Iterator::operator->() const {
-  return &(ptr->value);
+template <typename Key, typename Value, typename Compare, typename Allocator>
+const Value* Tree<Key, Value, Compare, Allocator>::Iterator::operator->(
+    ) const {
+  return &(static_cast<const Node*>(ptr)->value);
 }
 
 //
@@ -660,61 +1126,33 @@ const Value* Tree<Key, Value>::Iterator::operator->() const {
 //
 //
 
-template <typename Key, typename Value>
-bool Tree<Key, Value>::Iterator::operator==(const Iterator& other) const {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+bool Tree<Key, Value, Compare, Allocator>::Iterator::operator==(
+    const Iterator& other) const {
   return ptr == other.ptr;
 }
 
-template <typename Key, typename Value>
-bool Tree<Key, Value>::Iterator::operator!=(const Iterator& other) const {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+bool Tree<Key, Value, Compare, Allocator>::Iterator::operator!=(
+    const Iterator& other) const {
   return ptr != other.ptr;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Iterator& Tree<Key, Value>::Iterator::operator=(
-    const Iterator& it) {
-  if (this != &it) {
-    ptr = it.ptr;
-    stack = it.stack;
-    prev_stack = it.prev_stack;
-  }
-  return *this;
-}
-
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Iterator Tree<Key, Value>::Iterator::to_end(
-    Node* node) {
-  iterator res(node);
-  res.end = get_max(node);
-  while (res.ptr != res.end) {
-    ++res;
-  }
-  res.ptr = nullptr;
-  return res;
-}
-
 //
 //
 //
 //
 
-template <typename Key, typename Value>
-class Tree<Key, Value>::Const_Iterator {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+class Tree<Key, Value, Compare, Allocator>::Const_Iterator {
  private:
-  Node* end;
-
-  s21::stack<Node*> stack;
-  s21::stack<Node*> prev_stack;
-  void left_to_stack(Node* node);
-  Node* get_max(Node* node);
-  Node* next();
-  Node* prev();
+  const NodeBase* ptr;  // узел или заголовок дерева (cend())
 
  public:
-  Node* ptr;  // from private
-  Const_Iterator() = default;
-  Const_Iterator(Node* node);
+  Const_Iterator() : ptr(nullptr) {}
+  Const_Iterator(const NodeBase* node) : ptr(node) {}
   Const_Iterator(const Const_Iterator& it) = default;
+  Const_Iterator& operator=(const Const_Iterator& it) = default;
 
   Const_Iterator& operator++();
   Const_Iterator& operator--();
@@ -725,117 +1163,62 @@ class Tree<Key, Value>::Const_Iterator {
   bool operator!=(const Const_Iterator& other) const;
 
   const Node* get_node() const;
-  Const_Iterator to_end(Node* node);
-
-  const Value& operator*() const { return ptr->value; }
-
-  const Value* operator->() const { return &ptr->value; }
 
-  friend void Tree::assign(const Tree& other);
-  friend void Tree::erase(iterator pos);
-};
-
-template <typename Key, typename Value>
-inline Tree<Key, Value>::Const_Iterator::Const_Iterator(Node* node) {
-  left_to_stack(node);
-  ptr = next();
-}
-
-template <typename Key, typename Value>
-inline void Tree<Key, Value>::Const_Iterator::left_to_stack(Node* node) {
-  while (node) {
-    stack.push(node);
-    node = node->left;
+  const Value& operator*() const {
+    return static_cast<const Node*>(ptr)->value;
   }
-}
-
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::Const_Iterator::get_max(
-    Node* node) {
-  if (!node) return nullptr;
-  if (node->right)
-    return get_max(node->right);
-  else
-    return node;
-}
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::Const_Iterator::next() {
-  if (stack.empty()) return nullptr;
-  Node* node = stack.top();
-  stack.pop();
-  prev_stack.push(node);
-  left_to_stack(node->right);
-  return node;
-}
-
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Node* Tree<Key, Value>::Const_Iterator::prev() {
-  if (prev_stack.empty()) return nullptr;
-  Node* node = prev_stack.top();
-  prev_stack.pop();
-  stack.push(node);
-  return node;
-}
+  const Value* operator->() const {
+    return &static_cast<const Node*>(ptr)->value;
+  }
+};
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Const_Iterator&
-Tree<Key, Value>::Const_Iterator::operator++() {
-  ptr = next();
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Const_Iterator&
+Tree<Key, Value, Compare, Allocator>::Const_Iterator::operator++() {
+  ptr = next_node(ptr);
   return *this;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Const_Iterator&
-Tree<Key, Value>::Const_Iterator::operator--() {
-  ptr = prev();
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Const_Iterator&
+Tree<Key, Value, Compare, Allocator>::Const_Iterator::operator--() {
+  ptr = prev_node(ptr);
   return *this;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Const_Iterator
-Tree<Key, Value>::Const_Iterator::operator++(int) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Const_Iterator
+Tree<Key, Value, Compare, Allocator>::Const_Iterator::operator++(int) {
   const_iterator it(*this);
   ++(*this);
   return it;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Const_Iterator
-Tree<Key, Value>::Const_Iterator::operator--(int) {
+template <typename Key, typename Value, typename Compare, typename Allocator>
+typename Tree<Key, Value, Compare, Allocator>::Const_Iterator
+Tree<Key, Value, Compare, Allocator>::Const_Iterator::operator--(int) {
   const_iterator it(*this);
   --(*this);
   return it;
 }
 
-template <typename Key, typename Value>
-bool Tree<Key, Value>::Const_Iterator::operator==(
+template <typename Key, typename Value, typename Compare, typename Allocator>
+bool Tree<Key, Value, Compare, Allocator>::Const_Iterator::operator==(
     const Const_Iterator& other) const {
   return ptr == other.ptr;
 }
 
-template <typename Key, typename Value>
-bool Tree<Key, Value>::Const_Iterator::operator!=(
+template <typename Key, typename Value, typename Compare, typename Allocator>
+bool Tree<Key, Value, Compare, Allocator>::Const_Iterator::operator!=(
     const Const_Iterator& other) const {
   return ptr != other.ptr;
 }
 
-template <typename Key, typename Value>
-typename Tree<Key, Value>::Const_Iterator
-Tree<Key, Value>::Const_Iterator::to_end(Node* node) {
-  const_iterator res(node);
-  res.end = get_max(node);
-  while (res.ptr != res.end) {
-    ++res;
-  }
-  res.ptr = nullptr;
-  return res;
-}
-
-template <typename Key, typename Value>
-const typename Tree<Key, Value>::Node*
-Tree<Key, Value>::Const_Iterator::get_node() const {
-  return ptr;
+template <typename Key, typename Value, typename Compare, typename Allocator>
+const typename Tree<Key, Value, Compare, Allocator>::Node*
+Tree<Key, Value, Compare, Allocator>::Const_Iterator::get_node() const {
+  return ptr && ptr->height ? static_cast<const Node*>(ptr) : nullptr;
 }
 
 }  // namespace s21
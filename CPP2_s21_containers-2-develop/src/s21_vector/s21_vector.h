@@ -1,8 +1,13 @@
 #ifndef VECTOR_H
 #define VECTOR_H
+#include <algorithm>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <type_traits>
 
 namespace s21 {
 template <typename T>
@@ -19,9 +24,10 @@ class vector {
   explicit vector(size_type n);
   vector(std::initializer_list<value_type> const &items);
   vector(const vector<T> &v);
-  vector(vector<T> &&v);
+  vector(vector<T> &&v) noexcept(std::is_nothrow_move_constructible_v<T>);
   ~vector();
-  vector<T> &operator=(vector<T> &&v);
+  vector<T> &operator=(vector<T> &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
 
   vector &operator=(const vector &other);
 
@@ -40,14 +46,28 @@ class vector {
   void reserve(size_type size);
   size_type capacity();
   void shrink_to_fit();
+  void resize(size_type count);
+  void resize(size_type count, const_reference value);
 
   void clear();
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
   void pop_back();
   void swap(vector &other);
 
+  void assign(size_type count, const_reference value);
+  template <typename ForwardIt,
+            typename = std::enable_if_t<!std::is_integral_v<ForwardIt>>>
+  void assign(ForwardIt first, ForwardIt last);
+  void assign(std::initializer_list<value_type> items);
+
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
   template <typename... Args>
@@ -56,10 +76,25 @@ class vector {
   void bring_to_zero();
   void delete_arr();
 
- private:
+ protected:
+  vector(T *buffer, size_type capacity) noexcept;
+  void take(vector &v);
+  bool is_inline() const;
+
+  static T *allocate(size_type n);
+  void deallocate();
+  static void relocate(T *first, T *last, T *dest);
+  void reallocate(size_type n);
+  size_type next_capacity() const;
+  template <typename... Args>
+  size_type emplace_at(size_type index, Args &&...args);
+
   T *arr_;
   size_t size_;
   size_t capacity_;
+  // встроенный буфер наследника (small_vector), им вектор не владеет
+  T *inline_ = nullptr;
+  size_t inline_capacity_ = 0;
 };
 
 template <typename T>
@@ -82,12 +117,12 @@ inline vector<T>::vector() : arr_(nullptr), size_(0), capacity_(0) {}
 
 template <typename T>
 inline vector<T>::vector(size_type n)
-    : arr_(new value_type[n]), size_(n), capacity_(n) {
-  if (arr_ == nullptr) {
-    throw std::bad_alloc();
-  }
-  for (size_type i = 0; i < n; ++i) {
-    arr_[i] = T();
+    : arr_(allocate(n)), size_(n), capacity_(n) {
+  try {
+    std::uninitialized_value_construct(arr_, arr_ + n);
+  } catch (...) {
+    deallocate();
+    throw;
   }
 }
 
@@ -102,57 +137,200 @@ inline typename vector<T>::iterator vector<T>::end() {
 }
 
 template <typename T>
-inline vector<T>::vector(std::initializer_list<value_type> const &items) {
-  arr_ = new value_type[items.size()];
-  int i = 0;
-  for (auto it = items.begin(); it != items.end(); it++) {
-    arr_[i] = *it;
-    i++;
+inline vector<T>::vector(std::initializer_list<value_type> const &items)
+    : arr_(allocate(items.size())),
+      size_(items.size()),
+      capacity_(items.size()) {
+  try {
+    std::uninitialized_copy(items.begin(), items.end(), arr_);
+  } catch (...) {
+    deallocate();
+    throw;
   }
-  size_ = items.size();
-  capacity_ = items.size();
 };
 
 template <typename T>
-inline vector<T>::vector(const vector<T> &v) : vector(v.size_) {
-  for (size_t i = 0; i < size_; i++) arr_[i] = v.arr_[i];
+inline vector<T>::vector(const vector<T> &v)
+    : arr_(allocate(v.size_)), size_(v.size_), capacity_(v.size_) {
+  try {
+    std::uninitialized_copy(v.arr_, v.arr_ + v.size_, arr_);
+  } catch (...) {
+    deallocate();
+    throw;
+  }
 }
 
 template <typename T>
 void vector<T>::bring_to_zero() {
   this->size_ = 0;
-  this->capacity_ = 0;
-  this->arr_ = nullptr;
+  this->capacity_ = inline_capacity_;
+  this->arr_ = inline_;
+}
+
+template <typename T>
+inline vector<T>::vector(T *buffer, size_type capacity) noexcept
+    : arr_(buffer),
+      size_(0),
+      capacity_(capacity),
+      inline_(buffer),
+      inline_capacity_(capacity) {}
+
+// Между обычными векторами перенос - обмен указателями и не бросает.
+// Из встроенного буфера small_vector элементы переносятся поштучно в новую
+// память из кучи; при нехватке памяти здесь, как в любой noexcept-функции,
+// вызывается std::terminate. Чтобы перенос не выделял память, переносите
+// small_vector в small_vector с тем же N.
+template <typename T>
+inline vector<T>::vector(vector<T> &&v) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : arr_(nullptr), size_(0), capacity_(0) {
+  take(v);
 }
 
 template <typename T>
-inline vector<T>::vector(vector<T> &&v)
-    : arr_(v.arr_), size_(v.size_), capacity_(v.capacity_) {
+inline bool vector<T>::is_inline() const {
+  return inline_ && arr_ == inline_;
+}
+
+// Забирает содержимое v в пустой вектор. Память из кучи переходит целиком,
+// элементы из встроенного буфера переносятся поштучно (память выделяется,
+// только если их больше, чем помещается у приемника).
+template <typename T>
+inline void vector<T>::take(vector &v) {
+  if (!v.is_inline()) {
+    arr_ = v.arr_;
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+  } else {
+    reserve(v.size_);
+    relocate(v.arr_, v.arr_ + v.size_, arr_);
+    size_ = v.size_;
+    std::destroy(v.arr_, v.arr_ + v.size_);
+  }
   v.bring_to_zero();
 }
 
 template <typename T>
 inline vector<T>::~vector() {
-  delete[] arr_;
-  bring_to_zero();
+  delete_arr();
 }
 
 template <typename T>
 inline void vector<T>::delete_arr() {
   if (this->arr_) {
-    delete[] this->arr_;
+    std::destroy(arr_, arr_ + size_);
+    deallocate();
   }
   bring_to_zero();
 }
 
+// Сырая память под n элементов, объекты в ней не создаются
+template <typename T>
+inline T *vector<T>::allocate(size_type n) {
+  return n ? std::allocator<T>().allocate(n) : nullptr;
+}
+
+template <typename T>
+inline void vector<T>::deallocate() {
+  if (arr_ && arr_ != inline_) {
+    std::allocator<T>().deallocate(arr_, capacity_);
+  }
+}
+
+// Перенос [first, last) в неинициализированную память dest: memcpy для
+// тривиально копируемых типов, иначе перемещение, если оно не бросает
+// исключений (или копирования нет), и копирование в остальных случаях.
+// Источник не разрушается - это делает вызывающий после успеха.
+template <typename T>
+inline void vector<T>::relocate(T *first, T *last, T *dest) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dest), first,
+                  (last - first) * sizeof(T));
+    }
+  } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                       !std::is_copy_constructible_v<T>) {
+    std::uninitialized_move(first, last, dest);
+  } else {
+    std::uninitialized_copy(first, last, dest);
+  }
+}
+
 template <typename T>
-inline vector<T> &vector<T>::operator=(vector<T> &&v) {
+inline void vector<T>::reallocate(size_type n) {
+  T *fresh = allocate(n);
+  try {
+    relocate(arr_, arr_ + size_, fresh);
+  } catch (...) {
+    std::allocator<T>().deallocate(fresh, n);
+    throw;
+  }
+  std::destroy(arr_, arr_ + size_);
+  deallocate();
+  arr_ = fresh;
+  capacity_ = n;
+}
+
+template <typename T>
+inline typename vector<T>::size_type vector<T>::next_capacity() const {
+  return capacity_ == 0 ? 1 : capacity_ * 2;
+}
+
+// Создает элемент на позиции index, сдвигая хвост вправо. При росте
+// элемент строится в новом буфере до переноса старых, поэтому args могут
+// ссылаться на элементы самого вектора.
+template <typename T>
+template <typename... Args>
+inline typename vector<T>::size_type vector<T>::emplace_at(size_type index,
+                                                            Args &&...args) {
+  if (size_ == capacity_) {
+    size_type n = next_capacity();
+    T *fresh = allocate(n);
+    T *slot = fresh + index;
+    try {
+      ::new (static_cast<void *>(slot)) T(std::forward<Args>(args)...);
+      try {
+        relocate(arr_, arr_ + index, fresh);
+        try {
+          relocate(arr_ + index, arr_ + size_, slot + 1);
+        } catch (...) {
+          std::destroy(fresh, slot);
+          throw;
+        }
+      } catch (...) {
+        slot->~T();
+        throw;
+      }
+    } catch (...) {
+      std::allocator<T>().deallocate(fresh, n);
+      throw;
+    }
+    std::destroy(arr_, arr_ + size_);
+    deallocate();
+    arr_ = fresh;
+    capacity_ = n;
+  } else if (index == size_) {
+    ::new (static_cast<void *>(arr_ + size_)) T(std::forward<Args>(args)...);
+  } else {
+    T value(std::forward<Args>(args)...);
+    ::new (static_cast<void *>(arr_ + size_)) T(std::move(arr_[size_ - 1]));
+    // новый хвостовой элемент сразу принадлежит вектору: если сдвиг ниже
+    // бросит, его разрушит деструктор вектора
+    ++size_;
+    std::move_backward(arr_ + index, arr_ + size_ - 2, arr_ + size_ - 1);
+    arr_[index] = std::move(value);
+    return index;
+  }
+  ++size_;
+  return index;
+}
+
+template <typename T>
+inline vector<T> &vector<T>::operator=(vector<T> &&v) noexcept(
+    std::is_nothrow_move_constructible_v<T>) {
   if (this != &v) {
     this->delete_arr();
-    this->size_ = v.size_;
-    this->capacity_ = v.capacity_;
-    this->arr_ = v.arr_;
-    v.bring_to_zero();
+    take(v);
   }
   return *this;
 }
@@ -160,10 +338,7 @@ inline vector<T> &vector<T>::operator=(vector<T> &&v) {
 template <typename T>
 vector<T> &vector<T>::operator=(const vector &other) {
   if (this != &other) {
-    reserve(other.size_);
-    size_ = other.size_;
-    capacity_ = other.capacity_;
-    for (size_t i = 0; i < size_; i++) arr_[i] = other.arr_[i];
+    assign(other.arr_, other.arr_ + other.size_);
   }
   return *this;
 }
@@ -203,31 +378,64 @@ inline typename vector<T>::size_type vector<T>::max_size() const {
 
 template <typename T>
 inline void vector<T>::reserve(size_type size) {
-  if (size >= size_) {
-    vector<value_type> new_arr(size);
-    for (size_type i = 0; i < size_; ++i) {
-      new_arr.arr_[i] = arr_[i];
-    }
-    new_arr.size_ = size_;
-    *this = std::move(new_arr);
+  if (size > max_size()) {
+    throw std::length_error("Too large size for reserve");
+  }
+  if (size > capacity_) {
+    reallocate(size);
   }
 }
 
 template <typename T>
 inline void vector<T>::shrink_to_fit() {
-  if (size_ != capacity_) {
-    vector<value_type> new_arr(size_);
-    for (size_type i = 0; i < size_; ++i) {
-      new_arr.arr_[i] = arr_[i];
-    }
-    *this = std::move(new_arr);
+  if (size_ == 0) {
+    delete_arr();
+  } else if (is_inline()) {
+    return;
+  } else if (inline_ && size_ <= inline_capacity_) {
+    // элементы снова помещаются во встроенный буфер
+    relocate(arr_, arr_ + size_, inline_);
+    std::destroy(arr_, arr_ + size_);
+    deallocate();
+    arr_ = inline_;
+    capacity_ = inline_capacity_;
+  } else if (size_ != capacity_) {
+    reallocate(size_);
   }
 }
 
+template <typename T>
+inline void vector<T>::resize(size_type count) {
+  if (count > capacity_) {
+    reserve(std::max(count, next_capacity()));
+  }
+  if (count > size_) {
+    std::uninitialized_value_construct(arr_ + size_, arr_ + count);
+  } else {
+    std::destroy(arr_ + count, arr_ + size_);
+  }
+  size_ = count;
+}
+
+template <typename T>
+inline void vector<T>::resize(size_type count, const_reference value) {
+  if (count > capacity_) {
+    value_type copy(value);  // value может лежать в старом буфере
+    reserve(std::max(count, next_capacity()));
+    std::uninitialized_fill(arr_ + size_, arr_ + count, copy);
+  } else if (count > size_) {
+    std::uninitialized_fill(arr_ + size_, arr_ + count, value);
+  } else {
+    std::destroy(arr_ + count, arr_ + size_);
+  }
+  size_ = count;
+}
+
+// Память сохраняется, чтобы повторное заполнение не выделяло ее заново
 template <typename T>
 inline void vector<T>::clear() {
-  delete[] arr_;
-  bring_to_zero();
+  std::destroy(arr_, arr_ + size_);
+  size_ = 0;
 }
 
 template <typename T>
@@ -238,51 +446,78 @@ inline typename vector<T>::iterator vector<T>::insert(iterator pos,
   if (position < zero || position > this->size_) {
     throw std::out_of_range("Index out ot range");
   }
-  size_t index = pos - begin();
-  if (size_ == capacity_) {
-    reserve(capacity_ * 2);
-  }
-  for (size_t i = size_; i > index; i--) {
-    arr_[i] = arr_[i - 1];
-  }
-  arr_[index] = value;
-  size_++;
-  return begin() + index;
+  return begin() + emplace_at(position, value);
 }
 
 template <typename T>
 inline void vector<T>::erase(iterator pos) {
   size_t zero = 0;
   size_t position = &(*pos) - this->arr_;
-  if (position < zero || position > this->size_) {
+  if (position < zero || position >= this->size_) {
     throw std::out_of_range("Index out ot range");
   }
-  size_t index = pos - begin();
-  for (size_t i = index; i < size_ - 1; i++) {
-    arr_[i] = arr_[i + 1];
+  std::move(pos + 1, end(), pos);
+  pop_back();
+}
+
+template <typename T>
+inline typename vector<T>::iterator vector<T>::erase(iterator first,
+                                                     iterator last) {
+  if (first < begin() || first > last || last > end()) {
+    throw std::out_of_range("Index out ot range");
   }
-  size_--;
+  if (first != last) {
+    iterator tail = std::move(last, end(), first);
+    std::destroy(tail, end());
+    size_ = tail - begin();
+  }
+  return first;
 }
 
 template <typename T>
 inline void vector<T>::push_back(const_reference value) {
-  if (size_ >= capacity_) {
-    if (capacity_ == 0)
-      reserve(1);
-    else
-      reserve(capacity_ * 2);
+  emplace_at(size_, value);
+}
+
+template <typename T>
+inline void vector<T>::push_back(value_type &&value) {
+  emplace_at(size_, std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+inline typename vector<T>::reference vector<T>::emplace_back(Args &&...args) {
+  // индекс вычисляется до чтения arr_: emplace_at может перевыделить память
+  size_type index = emplace_at(size_, std::forward<Args>(args)...);
+  return arr_[index];
+}
+
+template <typename T>
+template <typename... Args>
+inline typename vector<T>::iterator vector<T>::emplace(const_iterator pos,
+                                                       Args &&...args) {
+  size_type index = pos - arr_;
+  if (index > size_) {
+    throw std::out_of_range("Index out ot range");
   }
-  arr_[size_] = value;
-  size_++;
+  return begin() + emplace_at(index, std::forward<Args>(args)...);
 }
 
 template <typename T>
 inline void vector<T>::pop_back() {
   size_ -= 1;
+  arr_[size_].~T();
 }
 
 template <typename T>
 inline void vector<T>::swap(vector &other) {
+  if (is_inline() || other.is_inline()) {
+    // встроенный буфер не переназначить - меняем элементы через перенос
+    vector<T> tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+    return;
+  }
   T *new_arr = arr_;
   size_t new_size = size_;
   size_t new_capacity = capacity_;
@@ -294,6 +529,64 @@ inline void vector<T>::swap(vector &other) {
   other.capacity_ = new_capacity;
 }
 
+// Существующие элементы переприсваиваются, лишние разрушаются, новые
+// создаются в свободной памяти; буфер меняется только если не хватает места
+template <typename T>
+template <typename ForwardIt, typename>
+inline void vector<T>::assign(ForwardIt first, ForwardIt last) {
+  size_type count = std::distance(first, last);
+  if (count > capacity_) {
+    T *fresh = allocate(count);
+    try {
+      std::uninitialized_copy(first, last, fresh);
+    } catch (...) {
+      std::allocator<T>().deallocate(fresh, count);
+      throw;
+    }
+    delete_arr();
+    arr_ = fresh;
+    capacity_ = count;
+  } else if (count > size_) {
+    ForwardIt middle = std::next(first, size_);
+    std::copy(first, middle, arr_);
+    std::uninitialized_copy(middle, last, arr_ + size_);
+  } else {
+    std::copy(first, last, arr_);
+    std::destroy(arr_ + count, arr_ + size_);
+  }
+  size_ = count;
+}
+
+template <typename T>
+inline void vector<T>::assign(size_type count, const_reference value) {
+  if (count > capacity_) {
+    T *fresh = allocate(count);
+    try {
+      std::uninitialized_fill(fresh, fresh + count, value);
+    } catch (...) {
+      std::allocator<T>().deallocate(fresh, count);
+      throw;
+    }
+    delete_arr();
+    arr_ = fresh;
+    capacity_ = count;
+    size_ = count;
+  } else if (count > size_) {
+    std::fill(arr_, arr_ + size_, value);
+    std::uninitialized_fill(arr_ + size_, arr_ + count, value);
+    size_ = count;
+  } else {
+    std::fill(arr_, arr_ + count, value);
+    std::destroy(arr_ + count, arr_ + size_);
+    size_ = count;
+  }
+}
+
+template <typename T>
+inline void vector<T>::assign(std::initializer_list<value_type> items) {
+  assign(items.begin(), items.end());
+}
+
 template <typename T>
 template <typename... Args>
 inline typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
@@ -303,12 +596,11 @@ inline typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
   if (size_ + count > capacity_) {
     reserve(size_ + count);
   }
-  for (size_type i = size_ + count - 1; i > index + count - 1; i--) {
-    arr_[i] = arr_[i - count];
-  }
-  size_ += count;
-  ((arr_[index++] = std::forward<Args>(args)), ...);
-  return begin() + index - 1;
+  // дописываем в конец и одним поворотом ставим на место
+  size_type old_size = size_;
+  (emplace_at(size_, std::forward<Args>(args)), ...);
+  std::rotate(begin() + index, begin() + old_size, end());
+  return begin() + index + count - 1;
 }
 
 template <typename value_type>
@@ -318,7 +610,7 @@ void vector<value_type>::insert_many_back(Args &&...args) {
   if (size_ + count > capacity_) {
     reserve(size_ + count);
   }
-  insert_many(end(), args...);
+  insert_many(end(), std::forward<Args>(args)...);
 }
 
 }  // namespace s21
@@ -4,6 +4,7 @@
 
 #include <vector>
 
+#include "../s21_small_vector/s21_small_vector.h"
 #include "../tests.cpp"
 
 TEST(vector_constructor, case1) {
@@ -721,3 +722,194 @@ TEST(vector_insert_many_back, case1) {
   EXPECT_EQ(s21_vec_string[2], "world");
   EXPECT_EQ(s21_vec_string[3], "!");
 }
+
+// считает конструирования, чтобы проверить, что рост не создает лишних копий
+struct Tracked {
+  static inline int defaults = 0, copies = 0, moves = 0, destroyed = 0;
+  std::string data;
+  Tracked() { ++defaults; }
+  explicit Tracked(std::string s) : data(std::move(s)) {}
+  Tracked(const Tracked &other) : data(other.data) { ++copies; }
+  Tracked(Tracked &&other) noexcept : data(std::move(other.data)) { ++moves; }
+  ~Tracked() { ++destroyed; }
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&) = default;
+  static void reset() { defaults = copies = moves = destroyed = 0; }
+};
+
+// перемещение может бросить исключение - при росте должны копировать
+struct ThrowingMove {
+  static inline int copies = 0;
+  int value;
+  explicit ThrowingMove(int v) : value(v) {}
+  ThrowingMove(const ThrowingMove &other) : value(other.value) { ++copies; }
+  ThrowingMove(ThrowingMove &&other) : value(other.value) {}
+  ThrowingMove &operator=(const ThrowingMove &) = default;
+};
+
+TEST(vector_push_back, growth_moves_without_copies) {
+  Tracked::reset();
+  s21::vector<Tracked> v;
+  for (int i = 0; i < 100; ++i) v.push_back(Tracked(std::to_string(i)));
+  EXPECT_EQ(Tracked::defaults, 0);
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(v.size(), 100U);
+  EXPECT_EQ(v[57].data, "57");
+  Tracked::reset();
+  v.reserve(1000);
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 100);
+}
+
+TEST(vector_push_back, throwing_move_is_copied) {
+  ThrowingMove::copies = 0;
+  s21::vector<ThrowingMove> v;
+  v.push_back(ThrowingMove(1));
+  v.push_back(ThrowingMove(2));
+  EXPECT_EQ(ThrowingMove::copies, 1);
+  EXPECT_EQ(v[0].value, 1);
+}
+
+TEST(vector_emplace_back, constructs_in_place) {
+  Tracked::reset();
+  s21::vector<Tracked> v;
+  v.reserve(4);
+  Tracked &last = v.emplace_back("abc");
+  EXPECT_EQ(last.data, "abc");
+  EXPECT_EQ(Tracked::copies + Tracked::moves, 0);
+  s21::vector<std::string> s{"a", "b"};
+  s.emplace_back(3, 'x');
+  s.push_back(s[0]);  // ссылка на собственный элемент при росте
+  s.emplace(s.begin() + 1, "mid");
+  EXPECT_EQ(s.size(), 5U);
+  EXPECT_EQ(s[1], "mid");
+  EXPECT_EQ(s[3], "xxx");
+  EXPECT_EQ(s[4], "a");
+}
+
+TEST(vector_emplace_back, reference_after_growth) {
+  s21::vector<std::string> v;
+  for (int i = 0; i < 20; ++i) {
+    bool grows = v.size() == v.capacity();
+    std::string &r = v.emplace_back(40 + i, 'x');
+    EXPECT_EQ(&r, &v.back()) << "grows: " << grows;
+    EXPECT_EQ(r.size(), static_cast<size_t>(40 + i));
+  }
+}
+
+TEST(vector_clear, keeps_capacity_and_destroys) {
+  s21::vector<Tracked> v;
+  for (int i = 0; i < 10; ++i) v.emplace_back("x");
+  size_t capacity = v.capacity();
+  Tracked::reset();
+  v.clear();
+  EXPECT_EQ(Tracked::destroyed, 10);
+  EXPECT_EQ(v.size(), 0U);
+  EXPECT_EQ(v.capacity(), capacity);
+  v.emplace_back("y");
+  v.emplace_back("z");
+  Tracked::reset();
+  v.pop_back();
+  v.erase(v.begin());
+  EXPECT_EQ(Tracked::destroyed, 2);
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(vector_resize, grow_and_shrink) {
+  s21::vector<std::string> v{"a", "b"};
+  v.resize(4);
+  EXPECT_EQ(v.size(), 4U);
+  EXPECT_EQ(v[3], "");
+  v.resize(6, v[0]);
+  EXPECT_EQ(v[5], "a");
+  v.resize(1);
+  EXPECT_EQ(v.size(), 1U);
+  EXPECT_EQ(v[0], "a");
+}
+
+TEST(vector_erase, range) {
+  s21::vector<int> v{0, 1, 2, 3, 4, 5};
+  auto it = v.erase(v.begin() + 1, v.begin() + 4);
+  EXPECT_EQ(*it, 4);
+  EXPECT_EQ(v.size(), 3U);
+  EXPECT_EQ(v[2], 5);
+  EXPECT_EQ(v.erase(v.end(), v.end()), v.end());
+  EXPECT_ANY_THROW(v.erase(v.end(), v.begin()));
+}
+
+TEST(vector_assign, reuses_capacity) {
+  s21::vector<std::string> v{"a", "b", "c"};
+  v.reserve(10);
+  std::string *data = v.data();
+  v.assign({"x", "y", "z", "w"});
+  EXPECT_EQ(v.data(), data);
+  EXPECT_EQ(v.size(), 4U);
+  EXPECT_EQ(v[3], "w");
+  v.assign(2, "q");
+  EXPECT_EQ(v.size(), 2U);
+  EXPECT_EQ(v[1], "q");
+  std::vector<std::string> src(20, "s");
+  v.assign(src.begin(), src.end());
+  EXPECT_EQ(v.size(), 20U);
+  EXPECT_EQ(v.capacity(), 20U);
+  v.assign(30, v[0]);
+  EXPECT_EQ(v[29], "s");
+}
+
+TEST(vector_copy_assign, larger_capacity_source) {
+  // ёмкость приемника не берется у источника: иначе дальнейшие вставки
+  // пишут за пределы меньшего буфера
+  s21::vector<int> big{1, 2, 3};
+  big.reserve(100);
+  s21::vector<int> small{7};
+  small = big;
+  EXPECT_EQ(small.size(), 3U);
+  EXPECT_LT(small.capacity(), big.capacity());
+  for (int i = 4; i <= 60; ++i) small.push_back(i);
+  EXPECT_GE(small.capacity(), small.size());
+  for (int i = 0; i < 60; ++i) EXPECT_EQ(small[i], i + 1);
+}
+
+// копирование бросает, когда заканчивается бюджет; переноса нет
+struct ThrowingCopy {
+  static inline int live = 0;
+  static inline int budget = 1 << 30;
+  int value;
+  explicit ThrowingCopy(int v) : value(v) { ++live; }
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    spend();
+    ++live;
+  }
+  ThrowingCopy &operator=(const ThrowingCopy &other) {
+    spend();
+    value = other.value;
+    return *this;
+  }
+  ~ThrowingCopy() { --live; }
+  static void spend() {
+    if (budget-- == 0) throw std::runtime_error("copy");
+  }
+};
+
+template <typename Vector>
+void insert_with_throwing_shift() {
+  ThrowingCopy::live = 0;
+  {
+    ThrowingCopy::budget = 1 << 30;
+    Vector v;
+    v.reserve(8);
+    for (int i = 0; i < 4; ++i) v.emplace_back(i);
+    ThrowingCopy b(9);
+    // копия значения, копия в новый хвост, затем сдвиг бросает
+    ThrowingCopy::budget = 2;
+    EXPECT_THROW(v.insert(v.begin() + 1, b), std::runtime_error);
+    ThrowingCopy::budget = 1 << 30;
+    EXPECT_EQ(v.size(), 5U);
+  }
+  EXPECT_EQ(ThrowingCopy::live, 0);
+}
+
+TEST(vector_insert, throwing_shift_does_not_leak) {
+  insert_with_throwing_shift<s21::vector<ThrowingCopy>>();
+  insert_with_throwing_shift<s21::small_vector<ThrowingCopy, 8>>();
+}
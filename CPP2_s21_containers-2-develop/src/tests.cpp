@@ -6,11 +6,16 @@
 #include <gtest/gtest.h>
 
 #include "s21_array/s21_array_test.cpp"
+#include "s21_deque/s21_deque_test.cc"
 #include "s21_list/s21_list_test.cpp"
+#include "s21_lockfree_queue/s21_lockfree_queue_test.cc"
 #include "s21_map/s21_map_test.cpp"
 #include "s21_multiset/s21_multiset_test.cpp"
 #include "s21_queue/s21_queue_test.cc"
+#include "s21_ring_buffer/s21_ring_buffer_test.cc"
+#include "s21_scheduler/s21_scheduler_test.cc"
 #include "s21_set/s21_set_test.cpp"
+#include "s21_small_vector/s21_small_vector_test.cc"
 #include "s21_stack/s21_stack_test.cc"
 #include "s21_vector/s21_vector_test.cc"
 